@@ -29,9 +29,6 @@
 #define FLAGS_INIT      (1U << 0)
 #define FLAGS_START     (1U << 1)
 #define FLAGS_SINGLE    (1U << 2)
-#define FLAGS_LIMIT_OWN (1U << 3)
-#define FLAGS_BUF_EMPTY (1U << 4)
-#define FLAGS_BUF_FULL  (1U << 5)
 
 /* Low Level Driver Instance */
 extern ARM_DRIVER_CDC200  Driver_CDC200;
@@ -44,13 +41,28 @@ typedef struct {
     uint32_t block_size; /* Size of block in data buffer    */
 } StreamBuf_t;
 
+/*
+  Blocks are used in ring order and counted with free running block counters
+  (block index = counter % block_num):
+    [cnt_free, cnt_out) blocks latched by the display controller, the last
+                        one is (or becomes on next frame) the displayed frame
+    [cnt_out,  cnt_rel) blocks released by the application, waiting for display
+    [cnt_rel,  cnt_get) blocks owned by the application
+  Remaining blocks are free and returned by GetBlock.
+
+  In continuous mode the next waiting block is flipped to the display on each
+  start of frame, and the block shown until then is freed one frame later,
+  once the display controller no longer reads it.
+*/
+
 // Video Driver Configuration Parameters
 typedef struct {
     vStreamEvent_t    callback;  /* VideoOut callback       */
     StreamBuf_t       buf;       /* VideoOut stream buffer  */
-    volatile uint32_t idx_get;   /* Index of block to be returned on GetBlock call     */
-    volatile uint32_t idx_rel;   /* Index of block to be released on ReleaseBlock call */
-    volatile uint32_t idx_out;   /* Index of block currently beeing streamed           */
+    volatile uint32_t cnt_get;   /* Number of blocks returned by GetBlock              */
+    volatile uint32_t cnt_rel;   /* Number of blocks released by ReleaseBlock          */
+    volatile uint32_t cnt_out;   /* Number of blocks passed to the display controller  */
+    volatile uint32_t cnt_free;  /* Number of blocks freed by the display              */
     volatile uint8_t  active;    /* Streaming active flag */
     volatile uint8_t  underflow; /* Buffer underflow flag */
     volatile uint8_t  eos;       /* End of stream flag    */
@@ -60,54 +72,62 @@ typedef struct {
 /* vStream Handle */
 static StreamHandle_t hVideoOut = {0};
 
+/* Pass the next released block to the display controller */
+static void *LatchBlock(void)
+{
+    uint32_t buf_index;
+
+    buf_index          = (hVideoOut.cnt_out % hVideoOut.buf.block_num) * hVideoOut.buf.block_size;
+    hVideoOut.cnt_out += 1U;
+
+    return &hVideoOut.buf.data[buf_index];
+}
+
 /* Low Level Driver Callback */
 static void DriverCDC_Callback(uint32_t cb_event)
 {
     uint32_t event;
-    uint32_t buf_index;
 
     event = 0U;
 
     if (cb_event & ARM_CDC_SCANLINE0_EVENT) {
         /* Start of frame */
-        event             |= VSTREAM_EVENT_DATA;
-
-        /* Increment index of the block beeing streamed */
-        hVideoOut.idx_out  = (hVideoOut.idx_out + 1) % hVideoOut.buf.block_num;
-
-        /* Clear buffer full flag */
-        hVideoOut.flags   &= ~FLAGS_BUF_FULL;
+        if (hVideoOut.active == 0U) {
+            /* Not streaming, nothing to update */
+        } else if (hVideoOut.flags & FLAGS_SINGLE) {
+            /* Single mode, frame is displayed: return the block and clear active flag */
+            event               |= VSTREAM_EVENT_DATA;
+
+            hVideoOut.cnt_free   = hVideoOut.cnt_out;
+            hVideoOut.active     = 0U;
+        } else {
+            /* Continuous mode */
+            event               |= VSTREAM_EVENT_DATA;
 
-        if (hVideoOut.idx_out == hVideoOut.idx_rel) {
-            /* Buffer is empty */
-            hVideoOut.flags |= FLAGS_BUF_EMPTY;
+            /* Block latched on previous frame is now displayed, free the blocks before it */
+            hVideoOut.cnt_free   = hVideoOut.cnt_out - 1U;
 
-            if ((hVideoOut.flags & FLAGS_SINGLE) == 0U) {
-                /* Continuous mode, no new stream buffer */
+            if (hVideoOut.cnt_out == hVideoOut.cnt_rel) {
+                /* No new block, keep displaying the current one */
                 hVideoOut.underflow  = 1U;
 
                 event               |= VSTREAM_EVENT_UNDERFLOW;
+            } else {
+                /* Flip to the next block on next frame */
+                DriverCDC->Control(CDC200_FRAMEBUF_UPDATE, (uint32_t)LatchBlock());
             }
         }
-
-        if (hVideoOut.flags & FLAGS_SINGLE) {
-            /* Single mode, only clear active flag */
-            hVideoOut.active = 0U;
-        } else {
-            /* Continuous mode, determine streaming buffer index */
-            buf_index = hVideoOut.idx_out * hVideoOut.buf.block_size;
-
-            /* Set new frame buffer address */
-            DriverCDC->Control(CDC200_FRAMEBUF_UPDATE, (uint32_t) &hVideoOut.buf.data[buf_index]);
-        }
     }
 
     if (cb_event & ARM_CDC_DSI_ERROR_EVENT) {
         /* Error, stream stopped */
         event            |= VSTREAM_EVENT_EOS;
 
-        hVideoOut.active  = 0U;
-        hVideoOut.eos     = 1U;
+        hVideoOut.active   = 0U;
+        hVideoOut.eos      = 1U;
+
+        /* Display no longer reads the latched blocks */
+        hVideoOut.cnt_free = hVideoOut.cnt_out;
     }
 
     if ((hVideoOut.callback != NULL) && (event != 0U)) {
@@ -206,13 +226,11 @@ static int32_t SetBuf(void *buf, uint32_t buf_size, uint32_t block_size)
         hVideoOut.buf.block_num   = buf_size / block_size;
         hVideoOut.buf.block_size  = block_size;
 
-        /* Buffer is empty */
-        hVideoOut.flags          |= FLAGS_BUF_EMPTY;
-
-        /* Reset indexes */
-        hVideoOut.idx_out         = 0U;
-        hVideoOut.idx_get         = 0U;
-        hVideoOut.idx_rel         = 0U;
+        /* Reset block counters, all blocks are free */
+        hVideoOut.cnt_get         = 0U;
+        hVideoOut.cnt_rel         = 0U;
+        hVideoOut.cnt_out         = 0U;
+        hVideoOut.cnt_free        = 0U;
 
         rval                      = VSTREAM_OK;
     }
@@ -233,20 +251,20 @@ static int32_t Start(uint32_t mode)
     } else if (hVideoOut.buf.data == NULL) {
         /* Buffer not set */
         rval = VSTREAM_ERROR;
-    } else if ((hVideoOut.flags & FLAGS_BUF_EMPTY) != 0) {
-        /* Buffer is empty */
-        rval = VSTREAM_ERROR;
     } else if (hVideoOut.active == 1U) {
         /* Already active */
         rval = VSTREAM_OK;
+    } else if (hVideoOut.cnt_out == hVideoOut.cnt_rel) {
+        /* No released block to display */
+        rval = VSTREAM_ERROR;
+    } else if ((mode != VSTREAM_MODE_SINGLE) && (hVideoOut.buf.block_num < 2U)) {
+        /* Continuous mode flips between at least two blocks */
+        rval = VSTREAM_ERROR;
     } else {
         rval             = VSTREAM_OK;
 
-        /* Set active status */
-        hVideoOut.active = 1U;
-
-        /* Set pointer to frame buffer */
-        buf              = &hVideoOut.buf.data[hVideoOut.idx_rel * hVideoOut.buf.block_size];
+        /* Pass next released block to the display */
+        buf              = LatchBlock();
 
         if (mode == VSTREAM_MODE_SINGLE) {
             /* Single mode */
@@ -274,9 +292,12 @@ static int32_t Start(uint32_t mode)
                 }
             }
         }
-        if (rval != VSTREAM_OK) {
-            /* Clear active flag */
-            hVideoOut.active = 0U;
+        if (rval == VSTREAM_OK) {
+            /* Set active status */
+            hVideoOut.active   = 1U;
+        } else {
+            /* Return the latched block */
+            hVideoOut.cnt_free = hVideoOut.cnt_out;
         }
     }
 
@@ -305,15 +326,18 @@ static int32_t Stop(void)
         }
 
         /* Enable call of the CDC driver Start() function */
-        hVideoOut.flags  &= ~FLAGS_START;
+        hVideoOut.flags   &= ~FLAGS_START;
 
-        hVideoOut.active  = 0U;
+        hVideoOut.active   = 0U;
+
+        /* Display no longer reads the latched blocks */
+        hVideoOut.cnt_free = hVideoOut.cnt_out;
     }
 
     return rval;
 }
 
-/* Get pointer to a data block */
+/* Get pointer to a free data block, does not wait for the display */
 static void *GetBlock(void)
 {
     uint32_t buf_index;
@@ -322,23 +346,18 @@ static void *GetBlock(void)
     if (hVideoOut.buf.data == NULL) {
         /* Buffer not set */
         p = NULL;
-    } else if ((hVideoOut.flags & FLAGS_LIMIT_OWN) != 0) {
-        /* App already owns all the blocks */
+    } else if ((hVideoOut.cnt_get - hVideoOut.cnt_free) >= hVideoOut.buf.block_num) {
+        /* No free block, all blocks are owned by the app or used by the display */
         p = NULL;
     } else {
         /* Determine buffer index */
-        buf_index         = hVideoOut.idx_get * hVideoOut.buf.block_size;
+        buf_index         = (hVideoOut.cnt_get % hVideoOut.buf.block_num) * hVideoOut.buf.block_size;
 
         /* Set return pointer */
         p                 = &hVideoOut.buf.data[buf_index];
 
-        /* Increment index of block returned by Get */
-        hVideoOut.idx_get = (hVideoOut.idx_get + 1U) % hVideoOut.buf.block_num;
-
-        if (hVideoOut.idx_get == hVideoOut.idx_rel) {
-            /* App owns all the blocks, set the limit flag */
-            hVideoOut.flags |= FLAGS_LIMIT_OWN;
-        }
+        /* Increment number of blocks returned by Get */
+        hVideoOut.cnt_get = hVideoOut.cnt_get + 1U;
     }
 
     return p;
@@ -352,26 +371,14 @@ static int32_t ReleaseBlock(void)
     if (hVideoOut.buf.data == NULL) {
         /* Buffer not set */
         rval = VSTREAM_ERROR;
-    } else if ((hVideoOut.idx_rel == hVideoOut.idx_get) &&
-               ((hVideoOut.flags & FLAGS_LIMIT_OWN) == 0)) {
+    } else if (hVideoOut.cnt_rel == hVideoOut.cnt_get) {
         /* No blocks to release */
         rval = VSTREAM_ERROR;
     } else {
-        /* Increment index of the block to be released next */
-        hVideoOut.idx_rel = (hVideoOut.idx_rel + 1U) % hVideoOut.buf.block_num;
-
-        if (hVideoOut.idx_rel == hVideoOut.idx_out) {
-            /* Buffer is full */
-            hVideoOut.flags |= FLAGS_BUF_FULL;
-        }
-
-        /* Clear the limit get flag */
-        hVideoOut.flags &= ~FLAGS_LIMIT_OWN;
+        /* Queue the oldest owned block for display */
+        hVideoOut.cnt_rel = hVideoOut.cnt_rel + 1U;
 
-        /* Clear the buffer empty flag */
-        hVideoOut.flags &= ~FLAGS_BUF_EMPTY;
-
-        rval             = VSTREAM_OK;
+        rval              = VSTREAM_OK;
     }
 
     return rval;
@@ -0,0 +1,710 @@
+/* Copyright 2026 Arm Limited and/or its affiliates.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "arm_event_tracer.h"
+
+#include <executorch/runtime/platform/platform.h>
+#include <stdint.h>
+#include <string.h>
+
+using executorch::runtime::AllocatorID;
+using executorch::runtime::ArrayRef;
+using executorch::runtime::ChainID;
+using executorch::runtime::DebugHandle;
+using executorch::runtime::DelegateDebugIdType;
+using executorch::runtime::DelegateDebugIntId;
+using executorch::runtime::EValue;
+using executorch::runtime::EventTracerEntry;
+using executorch::runtime::EventTracerFilterBase;
+using executorch::runtime::kUnsetChainId;
+using executorch::runtime::kUnsetDelegateDebugIntId;
+using executorch::runtime::LoggedEValueType;
+using executorch::runtime::Result;
+
+namespace {
+
+enum RecordType : uint16_t {
+  kRecordBlock,
+  kRecordProfile,
+  kRecordAllocation,
+};
+
+// Name of the run holding the events recorded before the first event block.
+const char* const kDefaultRunName = "Default";
+
+// ETDump file identifier, follows the root offset.
+const char kFileIdentifier[4] = {'E', 'D', '0', '0'};
+
+// ETDump schema version.
+constexpr uint32_t kETDumpVersion = 0;
+
+// The ETDump is written front to back in a single pass: every table is
+// placed after the table referencing it, so all offsets point forward and
+// positions of later objects are obtained by measuring them first. The
+// vtables of all tables are written once, directly after the file
+// identifier. Vtable: vtable size, table size, field offsets (0 = absent).
+const uint16_t kVtables[] = {
+    // ETDump: version, run_data
+    8, 12, 4, 8,
+    // RunData: name, bundled_input_index, allocators, events
+    12, 20, 4, 8, 12, 16,
+    // Allocator: name
+    6, 8, 4,
+    // Event: profile_event
+    6, 8, 4,
+    // Event: -, allocation_event
+    8, 8, 0, 4,
+    // ProfileEvent: name, chain_index, instruction_id, delegate_debug_id_int,
+    // -, -, start_time, end_time
+    20, 40, 4, 8, 12, 16, 0, 0, 24, 32,
+    // ProfileEvent without name
+    20, 40, 0, 8, 12, 16, 0, 0, 24, 32,
+    // AllocationEvent: allocator_id, allocation_size
+    8, 16, 4, 8,
+    // ProfileEvent with delegate_debug_metadata
+    20, 40, 4, 8, 12, 16, 0, 20, 24, 32,
+    // ProfileEvent without name, with delegate_debug_metadata
+    20, 40, 0, 8, 12, 16, 0, 20, 24, 32,
+};
+
+// Positions of the vtables: size prefix, root offset and file identifier
+// come first.
+constexpr size_t kVtEtdump = 12;
+constexpr size_t kVtRunData = kVtEtdump + 8;
+constexpr size_t kVtAllocator = kVtRunData + 12;
+constexpr size_t kVtProfileEventRef = kVtAllocator + 6;
+constexpr size_t kVtAllocationEventRef = kVtProfileEventRef + 6;
+constexpr size_t kVtProfileEvent = kVtAllocationEventRef + 8;
+constexpr size_t kVtProfileEventNoName = kVtProfileEvent + 20;
+constexpr size_t kVtAllocationEvent = kVtProfileEventNoName + 20;
+constexpr size_t kVtProfileEventMeta = kVtAllocationEvent + 8;
+constexpr size_t kVtProfileEventNoNameMeta = kVtProfileEventMeta + 20;
+constexpr size_t kVtEnd = kVtProfileEventNoNameMeta + 20;
+static_assert(kVtEnd == kVtEtdump + sizeof(kVtables), "vtable layout");
+
+// Inline size of the tables.
+constexpr size_t kEtdumpSize = 12;
+constexpr size_t kRunDataSize = 20;
+constexpr size_t kAllocatorSize = 8;
+constexpr size_t kEventSize = 8;
+constexpr size_t kProfileEventSize = 40;
+
+size_t align(size_t pos, size_t alignment) {
+  return (pos + alignment - 1) & ~(alignment - 1);
+}
+
+// Little-endian flatbuffer writer. Without a write function only the
+// position is advanced, which measures the size of the written objects.
+class FlatWriter {
+ public:
+  FlatWriter(size_t pos, ArmEventTracer::WriteFn write, void* arg)
+      : pos_(pos), write_(write), arg_(arg), len_(0) {}
+
+  ~FlatWriter() {
+    flush();
+  }
+
+  size_t pos() const {
+    return pos_;
+  }
+
+  void bytes(const void* data, size_t len) {
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    pos_ += len;
+    if (write_ == nullptr) {
+      return;
+    }
+    while (len > 0) {
+      size_t n = sizeof(buf_) - len_;
+      if (n > len) {
+        n = len;
+      }
+      memcpy(&buf_[len_], src, n);
+      len_ += n;
+      src += n;
+      len -= n;
+      if (len_ == sizeof(buf_)) {
+        flush();
+      }
+    }
+  }
+
+  void u8(uint8_t val) {
+    bytes(&val, 1);
+  }
+
+  void u16(uint16_t val) {
+    const uint8_t b[2] = {
+        static_cast<uint8_t>(val), static_cast<uint8_t>(val >> 8)};
+    bytes(b, sizeof(b));
+  }
+
+  void u32(uint32_t val) {
+    const uint8_t b[4] = {
+        static_cast<uint8_t>(val),
+        static_cast<uint8_t>(val >> 8),
+        static_cast<uint8_t>(val >> 16),
+        static_cast<uint8_t>(val >> 24)};
+    bytes(b, sizeof(b));
+  }
+
+  void u64(uint64_t val) {
+    u32(static_cast<uint32_t>(val));
+    u32(static_cast<uint32_t>(val >> 32));
+  }
+
+  void pad(size_t alignment) {
+    while ((pos_ & (alignment - 1)) != 0) {
+      u8(0);
+    }
+  }
+
+  // Offset to a later object, relative to the offset field.
+  void uoffset(size_t target) {
+    u32(static_cast<uint32_t>(target - pos_));
+  }
+
+  // Start of a table: signed offset from the table to its vtable.
+  void table(size_t vtable) {
+    u32(static_cast<uint32_t>(static_cast<int32_t>(pos_ - vtable)));
+  }
+
+  void string(const char* str) {
+    const size_t len = strlen(str);
+    pad(4);
+    u32(static_cast<uint32_t>(len));
+    bytes(str, len);
+    u8(0);
+  }
+
+  void flush() {
+    if ((write_ != nullptr) && (len_ > 0)) {
+      write_(buf_, len_, arg_);
+      len_ = 0;
+    }
+  }
+
+ private:
+  size_t pos_;
+  ArmEventTracer::WriteFn write_;
+  void* arg_;
+  uint8_t buf_[64];
+  size_t len_;
+};
+
+// Serialiser of the recorded events.
+class ETDumpWriter {
+ public:
+  ETDumpWriter(
+      const ArmEventTracer::Record* records,
+      size_t num_records,
+      const char* const* allocators,
+      size_t num_allocators)
+      : records_(records),
+        num_records_(num_records),
+        allocators_(allocators),
+        num_allocators_(num_allocators) {}
+
+  // Writes the complete ETDump, returns its size.
+  size_t write(ArmEventTracer::WriteFn write, void* arg) const {
+    FlatWriter measure(0, nullptr, nullptr);
+    etdump(measure, 0);
+    const size_t size = measure.pos();
+
+    if (write != nullptr) {
+      FlatWriter w(0, write, arg);
+      etdump(w, size);
+    }
+    return size;
+  }
+
+ private:
+  // Position after an object written from pos by fn.
+  template <typename Fn>
+  static size_t end_of(size_t pos, Fn fn) {
+    FlatWriter w(pos, nullptr, nullptr);
+    fn(w);
+    return w.pos();
+  }
+
+  // End of the run starting at records_[first].
+  size_t run_end(size_t first) const {
+    size_t i = first + 1;
+    while ((i < num_records_) && (records_[i].type != kRecordBlock)) {
+      i++;
+    }
+    return i;
+  }
+
+  void etdump(FlatWriter& w, size_t size) const {
+    const size_t etdump_pos = align(kVtEnd, 4);
+    const size_t run_data_pos = etdump_pos + kEtdumpSize;
+    size_t num_runs = 0;
+
+    for (size_t i = 0; i < num_records_; i = run_end(i)) {
+      num_runs++;
+    }
+
+    w.u32(static_cast<uint32_t>(size - 4));
+    w.uoffset(etdump_pos);
+    w.bytes(kFileIdentifier, sizeof(kFileIdentifier));
+    for (size_t i = 0; i < sizeof(kVtables) / sizeof(kVtables[0]); i++) {
+      w.u16(kVtables[i]);
+    }
+
+    w.pad(4);
+    w.table(kVtEtdump);
+    w.u32(kETDumpVersion);
+    w.uoffset(run_data_pos);
+
+    // Vector of RunData
+    w.u32(static_cast<uint32_t>(num_runs));
+    size_t pos = w.pos() + (4 * num_runs);
+    for (size_t i = 0; i < num_records_; i = run_end(i)) {
+      pos = align(pos, 4);
+      w.uoffset(pos);
+      pos = end_of(pos, [&](FlatWriter& m) { run(m, i); });
+    }
+    for (size_t i = 0; i < num_records_; i = run_end(i)) {
+      run(w, i);
+    }
+  }
+
+  void run(FlatWriter& w, size_t first) const {
+    const size_t last = run_end(first);
+    const char* name = kDefaultRunName;
+    size_t begin = first;
+
+    if (records_[first].type == kRecordBlock) {
+      name = records_[first].name;
+      begin++;
+    }
+
+    w.pad(4);
+    const size_t name_pos = align(w.pos() + kRunDataSize, 4);
+    const size_t allocators_pos =
+        align(end_of(name_pos, [&](FlatWriter& m) { m.string(name); }), 4);
+    const size_t events_pos = align(
+        end_of(allocators_pos, [&](FlatWriter& m) { allocators(m); }), 4);
+
+    w.table(kVtRunData);
+    w.uoffset(name_pos);
+    w.u32(static_cast<uint32_t>(-1)); // bundled_input_index
+    w.uoffset(allocators_pos);
+    w.uoffset(events_pos);
+    w.string(name);
+    allocators(w);
+    events(w, begin, last);
+  }
+
+  void allocators(FlatWriter& w) const {
+    w.pad(4);
+    w.u32(static_cast<uint32_t>(num_allocators_));
+    size_t pos = w.pos() + (4 * num_allocators_);
+    for (size_t i = 0; i < num_allocators_; i++) {
+      pos = align(pos, 4);
+      w.uoffset(pos);
+      pos = end_of(pos, [&](FlatWriter& m) { allocator(m, allocators_[i]); });
+    }
+    for (size_t i = 0; i < num_allocators_; i++) {
+      allocator(w, allocators_[i]);
+    }
+  }
+
+  static void allocator(FlatWriter& w, const char* name) {
+    w.pad(4);
+    w.table(kVtAllocator);
+    w.uoffset(w.pos() + 4);
+    w.string(name);
+  }
+
+  void events(FlatWriter& w, size_t first, size_t last) const {
+    w.pad(4);
+    w.u32(static_cast<uint32_t>(last - first));
+    size_t pos = w.pos() + (4 * (last - first));
+    for (size_t i = first; i < last; i++) {
+      pos = align(pos, 4);
+      w.uoffset(pos);
+      pos = end_of(pos, [&](FlatWriter& m) { event(m, records_[i]); });
+    }
+    for (size_t i = first; i < last; i++) {
+      event(w, records_[i]);
+    }
+  }
+
+  // Event table followed by its ProfileEvent or AllocationEvent table.
+  static void event(FlatWriter& w, const ArmEventTracer::Record& r) {
+    w.pad(4);
+    const size_t event_pos = w.pos();
+    const size_t child_pos = align(event_pos + kEventSize, 8);
+
+    if (r.type == kRecordAllocation) {
+      w.table(kVtAllocationEventRef);
+      w.uoffset(child_pos);
+      w.pad(8);
+      w.table(kVtAllocationEvent);
+      w.u32(static_cast<uint32_t>(r.instruction_id));
+      w.u64(r.start_time);
+      return;
+    }
+
+    // The name string and the metadata vector follow the ProfileEvent
+    const size_t name_pos = child_pos + kProfileEventSize;
+    size_t metadata_pos = name_pos;
+    if (r.name != nullptr) {
+      metadata_pos = align(
+          end_of(name_pos, [&](FlatWriter& m) { m.string(r.name); }), 4);
+    }
+
+    w.table(kVtProfileEventRef);
+    w.uoffset(child_pos);
+    w.pad(8);
+    if (r.metadata != nullptr) {
+      w.table(
+          (r.name != nullptr) ? kVtProfileEventMeta
+                              : kVtProfileEventNoNameMeta);
+    } else {
+      w.table((r.name != nullptr) ? kVtProfileEvent : kVtProfileEventNoName);
+    }
+    if (r.name != nullptr) {
+      w.uoffset(name_pos);
+    } else {
+      w.u32(0);
+    }
+    w.u32(static_cast<uint32_t>(r.chain_index));
+    w.u32(static_cast<uint32_t>(r.instruction_id));
+    w.u32(static_cast<uint32_t>(r.delegate_debug_id));
+    if (r.metadata != nullptr) {
+      w.uoffset(metadata_pos);
+    } else {
+      w.u32(0); // padding of start_time
+    }
+    w.u64(r.start_time);
+    w.u64(r.end_time);
+    if (r.name != nullptr) {
+      w.string(r.name);
+    }
+    if (r.metadata != nullptr) {
+      w.pad(4);
+      w.u32(r.metadata_len);
+      w.bytes(r.metadata, r.metadata_len);
+    }
+  }
+
+  const ArmEventTracer::Record* records_;
+  size_t num_records_;
+  const char* const* allocators_;
+  size_t num_allocators_;
+};
+
+} // namespace
+
+ArmEventTracer::ArmEventTracer(uint8_t* buffer, size_t size)
+    : records_(reinterpret_cast<Record*>(buffer)),
+      size_(size),
+      num_records_(0),
+      metadata_pos_(size),
+      dropped_(0),
+      allocators_(),
+      num_allocators_(0),
+      last_ticks_(0),
+      ticks_high_(0) {}
+
+ArmEventTracer::Record* ArmEventTracer::add_record() {
+  if ((num_records_ + 1) * sizeof(Record) > metadata_pos_) {
+    dropped_++;
+    return nullptr;
+  }
+  Record* r = &records_[num_records_++];
+  r->metadata = nullptr;
+  r->metadata_len = 0;
+  return r;
+}
+
+const uint8_t* ArmEventTracer::add_metadata(
+    const void* metadata,
+    size_t metadata_len) {
+  // Metadata is stored from the end of the buffer towards the records.
+  if ((metadata == nullptr) || (metadata_len == 0) ||
+      (metadata_len > UINT16_MAX) ||
+      (num_records_ * sizeof(Record) + metadata_len > metadata_pos_)) {
+    return nullptr;
+  }
+  metadata_pos_ -= metadata_len;
+  uint8_t* data = reinterpret_cast<uint8_t*>(records_) + metadata_pos_;
+  memcpy(data, metadata, metadata_len);
+  return data;
+}
+
+et_timestamp_t ArmEventTracer::now() {
+  // Extend the 32-bit cycle counter so that event times do not wrap.
+  const uint32_t ticks = static_cast<uint32_t>(et_pal_current_ticks());
+  if (ticks < last_ticks_) {
+    ticks_high_ += (static_cast<et_timestamp_t>(1) << 32);
+  }
+  last_ticks_ = ticks;
+  return ticks_high_ + ticks;
+}
+
+void ArmEventTracer::create_event_block(const char* name) {
+  Record* r = add_record();
+  if (r != nullptr) {
+    r->name = name;
+    r->type = kRecordBlock;
+  }
+}
+
+EventTracerEntry ArmEventTracer::start_profiling(
+    const char* name,
+    ChainID chain_id,
+    DebugHandle debug_handle) {
+  EventTracerEntry entry;
+  if (chain_id == kUnsetChainId) {
+    chain_id = chain_id_;
+    debug_handle = debug_handle_;
+  }
+  // Event names are string literals or strings of the loaded program, so
+  // the pointer is kept instead of a copy.
+  entry.event_id = static_cast<int64_t>(reinterpret_cast<intptr_t>(name));
+  entry.chain_id = chain_id;
+  entry.debug_handle = debug_handle;
+  entry.delegate_event_id_type = DelegateDebugIdType::kNone;
+  entry.start_time = now();
+  return entry;
+}
+
+void ArmEventTracer::end_profiling(EventTracerEntry prof_entry) {
+  const et_timestamp_t end_time = now();
+  Record* r = add_record();
+  if (r != nullptr) {
+    r->name = reinterpret_cast<const char*>(
+        static_cast<intptr_t>(prof_entry.event_id));
+    r->start_time = prof_entry.start_time;
+    r->end_time = end_time;
+    r->chain_index = prof_entry.chain_id;
+    r->instruction_id = static_cast<int32_t>(prof_entry.debug_handle);
+    r->delegate_debug_id = kUnsetDelegateDebugIntId;
+    r->type = kRecordProfile;
+  }
+}
+
+EventTracerEntry ArmEventTracer::start_profiling_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index) {
+  EventTracerEntry entry;
+  if (delegate_debug_index == kUnsetDelegateDebugIntId) {
+    entry.event_id = static_cast<int64_t>(reinterpret_cast<intptr_t>(name));
+    entry.delegate_event_id_type = DelegateDebugIdType::kStr;
+  } else {
+    entry.event_id = delegate_debug_index;
+    entry.delegate_event_id_type = DelegateDebugIdType::kInt;
+  }
+  entry.chain_id = chain_id_;
+  entry.debug_handle = debug_handle_;
+  entry.start_time = now();
+  return entry;
+}
+
+void ArmEventTracer::end_profiling_delegate(
+    EventTracerEntry event_tracer_entry,
+    const void* metadata,
+    size_t metadata_len) {
+  const et_timestamp_t end_time = now();
+  Record* r = add_record();
+  if (r != nullptr) {
+    r->metadata = add_metadata(metadata, metadata_len);
+    if (r->metadata != nullptr) {
+      r->metadata_len = static_cast<uint16_t>(metadata_len);
+    }
+    // Delegate events are identified by the name (string id) or the
+    // integer id, the instruction id is left unset.
+    if (event_tracer_entry.delegate_event_id_type == DelegateDebugIdType::kStr) {
+      r->name = reinterpret_cast<const char*>(
+          static_cast<intptr_t>(event_tracer_entry.event_id));
+      r->delegate_debug_id = kUnsetDelegateDebugIntId;
+    } else {
+      r->name = nullptr;
+      r->delegate_debug_id =
+          static_cast<int32_t>(event_tracer_entry.event_id);
+    }
+    r->start_time = event_tracer_entry.start_time;
+    r->end_time = end_time;
+    r->chain_index = event_tracer_entry.chain_id;
+    r->instruction_id = -1;
+    r->type = kRecordProfile;
+  }
+}
+
+void ArmEventTracer::log_profiling_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    et_timestamp_t start_time,
+    et_timestamp_t end_time,
+    const void* metadata,
+    size_t metadata_len) {
+  Record* r = add_record();
+  if (r != nullptr) {
+    r->metadata = add_metadata(metadata, metadata_len);
+    if (r->metadata != nullptr) {
+      r->metadata_len = static_cast<uint16_t>(metadata_len);
+    }
+    r->name = (delegate_debug_index == kUnsetDelegateDebugIntId) ? name
+                                                                 : nullptr;
+    r->start_time = start_time;
+    r->end_time = end_time;
+    r->chain_index = chain_id_;
+    r->instruction_id = -1;
+    r->delegate_debug_id = delegate_debug_index;
+    r->type = kRecordProfile;
+  }
+}
+
+AllocatorID ArmEventTracer::track_allocator(const char* name) {
+  if (num_allocators_ >= kMaxAllocators) {
+    return static_cast<AllocatorID>(kMaxAllocators - 1);
+  }
+  allocators_[num_allocators_] = name;
+  return static_cast<AllocatorID>(num_allocators_++);
+}
+
+void ArmEventTracer::track_allocation(AllocatorID id, size_t size) {
+  Record* r = add_record();
+  if (r != nullptr) {
+    r->name = nullptr;
+    r->start_time = size;
+    r->end_time = 0;
+    r->chain_index = chain_id_;
+    r->instruction_id = static_cast<int32_t>(id);
+    r->delegate_debug_id = kUnsetDelegateDebugIntId;
+    r->type = kRecordAllocation;
+  }
+}
+
+Result<bool> ArmEventTracer::log_evalue(
+    const EValue& evalue,
+    LoggedEValueType evalue_type) {
+  (void)evalue;
+  (void)evalue_type;
+  return false;
+}
+
+Result<bool> ArmEventTracer::log_intermediate_output_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    const executorch::aten::Tensor& output) {
+  (void)name;
+  (void)delegate_debug_index;
+  (void)output;
+  return false;
+}
+
+Result<bool> ArmEventTracer::log_intermediate_output_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    const ArrayRef<executorch::aten::Tensor> output) {
+  (void)name;
+  (void)delegate_debug_index;
+  (void)output;
+  return false;
+}
+
+Result<bool> ArmEventTracer::log_intermediate_output_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    const int& output) {
+  (void)name;
+  (void)delegate_debug_index;
+  (void)output;
+  return false;
+}
+
+Result<bool> ArmEventTracer::log_intermediate_output_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    const bool& output) {
+  (void)name;
+  (void)delegate_debug_index;
+  (void)output;
+  return false;
+}
+
+Result<bool> ArmEventTracer::log_intermediate_output_delegate(
+    const char* name,
+    DelegateDebugIntId delegate_debug_index,
+    const double& output) {
+  (void)name;
+  (void)delegate_debug_index;
+  (void)output;
+  return false;
+}
+
+void ArmEventTracer::set_delegation_intermediate_output_filter(
+    EventTracerFilterBase* event_tracer_filter) {
+  (void)event_tracer_filter;
+}
+
+size_t ArmEventTracer::write_etdump(WriteFn write, void* arg) const {
+  ETDumpWriter writer(records_, num_records_, allocators_, num_allocators_);
+  return writer.write(write, arg);
+}
+
+bool ArmEventTracer::set_event_metadata(
+    const char* name,
+    size_t n,
+    const void* metadata,
+    size_t metadata_len) {
+  size_t first = num_records_;
+  while ((first > 0) && (records_[first - 1].type != kRecordBlock)) {
+    first--;
+  }
+  for (size_t i = first; i < num_records_; i++) {
+    Record& r = records_[i];
+    if ((r.type != kRecordProfile) || (r.name == nullptr) ||
+        (strcmp(r.name, name) != 0)) {
+      continue;
+    }
+    if (n-- > 0) {
+      continue;
+    }
+    const uint8_t* data = add_metadata(metadata, metadata_len);
+    if (data == nullptr) {
+      return false;
+    }
+    r.metadata = data;
+    r.metadata_len = static_cast<uint16_t>(metadata_len);
+    return true;
+  }
+  return false;
+}
+
+bool ArmEventTracer::extend_event(const char* name) {
+  for (size_t i = num_records_; i > 0; i--) {
+    Record& r = records_[i - 1];
+    if (r.type == kRecordBlock) {
+      break;
+    }
+    if ((r.type == kRecordProfile) && (r.name != nullptr) &&
+        (strcmp(r.name, name) == 0)) {
+      r.end_time = now();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ArmEventTracer::reset() {
+  num_records_ = 0;
+  metadata_pos_ = size_;
+  dropped_ = 0;
+}
+
+size_t ArmEventTracer::num_events() const {
+  return num_records_;
+}
+
+size_t ArmEventTracer::dropped_events() const {
+  return dropped_;
+}
@@ -0,0 +1,153 @@
+/* Copyright 2026 Arm Limited and/or its affiliates.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <executorch/runtime/core/event_tracer.h>
+
+#pragma once
+
+// Event tracer that records profiling and allocation events into a fixed,
+// caller-provided buffer (no heap) and serialises them as an ETDump
+// flatbuffer, readable by the ExecuTorch Inspector. Events are recorded
+// until the buffer is full; further events are counted as dropped. Delegate
+// metadata is copied to the end of the same buffer.
+class ArmEventTracer : public executorch::runtime::EventTracer {
+ public:
+  // Called with consecutive chunks of the serialised ETDump.
+  typedef void (*WriteFn)(const uint8_t* data, size_t len, void* arg);
+
+  ArmEventTracer(uint8_t* buffer, size_t size);
+
+  void create_event_block(const char* name) override;
+
+  executorch::runtime::EventTracerEntry start_profiling(
+      const char* name,
+      executorch::runtime::ChainID chain_id =
+          executorch::runtime::kUnsetChainId,
+      executorch::runtime::DebugHandle debug_handle =
+          executorch::runtime::kUnsetDebugHandle) override;
+
+  void end_profiling(executorch::runtime::EventTracerEntry prof_entry) override;
+
+  executorch::runtime::EventTracerEntry start_profiling_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index) override;
+
+  void end_profiling_delegate(
+      executorch::runtime::EventTracerEntry event_tracer_entry,
+      const void* metadata = nullptr,
+      size_t metadata_len = 0) override;
+
+  void log_profiling_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      et_timestamp_t start_time,
+      et_timestamp_t end_time,
+      const void* metadata = nullptr,
+      size_t metadata_len = 0) override;
+
+  executorch::runtime::AllocatorID track_allocator(const char* name) override;
+
+  void track_allocation(
+      executorch::runtime::AllocatorID id,
+      size_t size) override;
+
+  // Intermediate outputs are not recorded.
+  executorch::runtime::Result<bool> log_evalue(
+      const executorch::runtime::EValue& evalue,
+      executorch::runtime::LoggedEValueType evalue_type) override;
+
+  executorch::runtime::Result<bool> log_intermediate_output_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      const executorch::aten::Tensor& output) override;
+
+  executorch::runtime::Result<bool> log_intermediate_output_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      const executorch::runtime::ArrayRef<executorch::aten::Tensor> output)
+      override;
+
+  executorch::runtime::Result<bool> log_intermediate_output_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      const int& output) override;
+
+  executorch::runtime::Result<bool> log_intermediate_output_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      const bool& output) override;
+
+  executorch::runtime::Result<bool> log_intermediate_output_delegate(
+      const char* name,
+      executorch::runtime::DelegateDebugIntId delegate_debug_index,
+      const double& output) override;
+
+  void set_delegation_intermediate_output_filter(
+      executorch::runtime::EventTracerFilterBase* event_tracer_filter)
+      override;
+
+  // Serialises the recorded events as a size-prefixed ETDump flatbuffer,
+  // one RunData per event block, and returns its size in bytes. The buffer
+  // is written in small chunks, so no memory is needed for the serialised
+  // data. With write == nullptr only the size is returned.
+  size_t write_etdump(WriteFn write, void* arg) const;
+
+  // Attaches metadata to a profiling event of the current run (since the
+  // last event block), the n-th one recorded with the given name. The data
+  // is written as delegate_debug_metadata of the event. Returns false if
+  // there is no such event or no space for the data.
+  bool set_event_metadata(
+      const char* name,
+      size_t n,
+      const void* metadata,
+      size_t metadata_len);
+
+  // Sets the end time of the last profiling event of the current run with
+  // the given name to now. Used for events that returned when an NPU job
+  // was started asynchronously, so that they end with the job as in a
+  // synchronous run. Returns false if there is no such event.
+  bool extend_event(const char* name);
+
+  // Discards the recorded events (the tracked allocators are kept).
+  void reset();
+
+  // Returns the number of recorded events.
+  size_t num_events() const;
+
+  // Returns the number of events dropped because the buffer was full.
+  size_t dropped_events() const;
+
+  // Maximum number of tracked allocators.
+  static constexpr size_t kMaxAllocators = 4;
+
+  // Record of one event, stored in the caller-provided buffer.
+  struct Record {
+    const char* name; // Event or event block name, or nullptr
+    const uint8_t* metadata; // Delegate metadata, or nullptr
+    et_timestamp_t start_time; // Allocation size for allocation events
+    et_timestamp_t end_time;
+    int32_t chain_index;
+    int32_t instruction_id; // Allocator id for allocation events
+    int32_t delegate_debug_id;
+    uint16_t type;
+    uint16_t metadata_len;
+  };
+
+ private:
+  Record* add_record();
+  const uint8_t* add_metadata(const void* metadata, size_t metadata_len);
+  et_timestamp_t now();
+
+  Record* records_;
+  size_t size_;
+  size_t num_records_;
+  size_t metadata_pos_; // Start of the metadata, at the end of the buffer
+  size_t dropped_;
+  const char* allocators_[kMaxAllocators];
+  size_t num_allocators_;
+  uint32_t last_ticks_;
+  et_timestamp_t ticks_high_;
+};
@@ -7,22 +7,39 @@
 #include <errno.h>
 #include <executorch/extension/data_loader/buffer_data_loader.h>
 #include <executorch/extension/runner_util/inputs.h>
+#include <executorch/runtime/core/exec_aten/util/tensor_util.h>
 #include <executorch/runtime/core/memory_allocator.h>
 #include <executorch/runtime/executor/program.h>
+#include <executorch/runtime/kernel/kernel_runtime_context.h>
+#include <executorch/runtime/kernel/operator_registry.h>
 #include <executorch/runtime/platform/log.h>
 #include <executorch/runtime/platform/platform.h>
 #include <executorch/runtime/platform/runtime.h>
+#include <executorch/schema/program_generated.h>
 #include <math.h>
 #include <stdio.h>
 #include <memory>
-#include <vector>
+#include <utility>
 #include "RTE_Components.h"
 #include "cmsis_vstream.h"
 #include "config_video.h"
+#include "config_ml_model.h"
 #include "image_processing_func.h"
+#include "display_overlay.h"
 #include CMSIS_device_header
 #include "arm_memory_allocator.h"
+#if defined(ET_EVENT_TRACER_ENABLED)
+#include "arm_event_tracer.h"
+#if ML_ETDUMP_OUTPUT == 1
+#include "cmsis_os2.h"
+#include "sds_rec_play.h"
+#endif
+#endif
 #include "profiler.h"
+#include "log_ring.h"
+#include "npu_pmu.h"
+#include "timeline.h"
+#include "latency_hist.h"
 #include "arm_executor_runner.h"  /* runner_output_label_t, RunnerContext (shared with sds_algorithm_user.cpp) */
 
 // AC6 (armclang) doesn't have unistd.h in bare-metal mode
@@ -40,6 +57,8 @@ using executorch::extension::BufferDataLoader;
 using executorch::runtime::Error;
 using executorch::runtime::EValue;
 using executorch::runtime::HierarchicalAllocator;
+using executorch::runtime::Kernel;
+using executorch::runtime::KernelRuntimeContext;
 using executorch::runtime::MemoryAllocator;
 using executorch::runtime::MemoryManager;
 using executorch::runtime::Method;
@@ -47,7 +66,6 @@ using executorch::runtime::MethodMeta;
 using executorch::runtime::Program;
 using executorch::runtime::Result;
 using executorch::runtime::Span;
-using executorch::runtime::Tag;
 using executorch::runtime::TensorInfo;
 
 /* ============================================================================
@@ -55,20 +73,9 @@ using executorch::runtime::TensorInfo;
  * ============================================================================
  */
 
-#define VEHICLE_MODEL            0
-#define BANANA_RIPENESS_MODEL    1
-#define TOOL_MODEL               2
-#define RPS_MODEL                3
 #define NUM_CLASSES              4
-#define FONT_WIDTH               8
-#define FONT_HEIGHT              8
-#define FONT_SCALE               2
-#define TEXT_BOTTOM_MARGIN       8
 #define OUTPUT_STRING_SIZE       100
 #define MAX_LABEL_NAME_LENGTH    100
-#define ASCII_CHAR_COUNT         128
-#define BYTES_PER_PIXEL_RGB888   3
-#define FONT_MSB_MASK            0x80
 #define PERCENT_SCALE            100.0f
 
 #define COLOR_RESET              "\033[0m"
@@ -97,9 +104,10 @@ extern vStreamDriver_t Driver_vStreamVideoOut;
 void et_pal_init(void) {
   // PMU initialization - using alternative approach if CMSIS PMU not available
 #if defined(__ARM_FEATURE_PMU_DWT)
-  // Enable cycle counter using DWT (Data Watchpoint and Trace)
+  // Enable cycle counter using DWT (Data Watchpoint and Trace). It is not
+  // reset: profiler_init() cleared it at startup and the CPU load accounting
+  // (cpu_load.c) already measures intervals across thread switches.
   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-  DWT->CYCCNT = 0;
   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 #elif defined(__PMU_PRESENT) 
   // Use ARM PMU if available
@@ -158,6 +166,16 @@ typedef runner_output_label_t output_label_t;
 /** \brief Video output stream driver */
 extern vStreamDriver_t Driver_vStreamVideoOut;
 
+/** \brief Ethos-U backend asynchronous execution (EthosUBackend.cpp) */
+extern "C" int  EthosUBackend_request_async(void);
+extern "C" int  EthosUBackend_async_pending(void);
+extern "C" int  EthosUBackend_wait(void);
+extern "C" void EthosUBackend_cancel_async(void);
+
+/** \brief Ethos-U backend scratch shared by all delegates (EthosUBackend.cpp) */
+extern "C" size_t EthosUBackend_scratch_size(void);
+extern "C" int    EthosUBackend_set_scratch(void* scratch, size_t size);
+
 /* ============================================================================
  * Global Variables
  * ============================================================================
@@ -184,7 +202,28 @@ constexpr int W = IMAGE_WIDTH;
 
 constexpr int C = IMAGE_CHANNELS;
 
-static float input_tensor_data[1 * C * H * W];
+#if !ML_INPUT_FUSED_QUANT
+/** \brief Application-owned input, bound to a model input that is not memory planned */
+static float __attribute__((aligned(16))) input_tensor_data[1 * C * H * W];
+
+/**
+ * \brief Destination of the float pre-processing.
+ *
+ * preprocess() writes into the model input tensor, which is either memory
+ * planned or bound to input_tensor_data at load time. The tensor is kept
+ * rather than its data pointer, since the Ethos-U backend may move the data
+ * onto its scratch area.
+ */
+typedef struct {
+    executorch::aten::TensorImpl* target; /**< Model input tensor */
+} input_binding_t;
+
+/** \brief Input binding of each loaded model */
+static input_binding_t input_bindings[ML_MAX_MODELS];
+
+/** \brief Input binding of the active model */
+static input_binding_t* input_binding = &input_bindings[0];
+#endif
 
 constexpr float mean[3] = {0.485f, 0.456f, 0.406f};
 
@@ -205,6 +244,16 @@ unsigned char __attribute__((
     section(".bss.activation_buf_sram"),
     aligned(16))) temp_allocation_pool[temp_allocation_pool_size];
 
+#if defined(ET_EVENT_TRACER_ENABLED)
+/** \brief Event tracer buffer, holds the recorded profiling events */
+unsigned char __attribute__((
+    section(ML_ETDUMP_BUF_SECTION),
+    aligned(16))) etdump_buffer[ML_ETDUMP_BUF_SIZE];
+
+/** \brief Event tracer of all loaded models */
+static ArmEventTracer event_tracer(etdump_buffer, sizeof(etdump_buffer));
+#endif
+
 #if ENABLE_TIME_PROFILING
 /** \brief Loading time in cycles */
 uint32_t loading_time = 0;
@@ -232,106 +281,44 @@ uint32_t display_time = 0;
  * Static Constants
  * ============================================================================
  */
-static const char* VEHICLE_CLASS_NAMES[] = {"UNKNOWN", "BUS", "CAR", "TRUCK"};
-static const char* BANANA_CLASS_NAMES[] = {"Overripe", "Ripe", "Rotten",
-                                           "Unripe"};
-static const char* TOOL_CLASS_NAMES[] = {"Bolt", "Hammer", "Nail", "Nut"};
-static const char* RPS_CLASS_NAMES[] = {"PAPER", "ROCK", "SCISSORS", "UNKNOWN"};
-
-/* Traditional array initialization (no designated initializers) */
-static const uint8_t font_8x8[ASCII_CHAR_COUNT][8] = {
-    /* Initialize first 32 entries (control characters) to blank */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 0 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 1 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 2 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 3 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 4 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 5 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 6 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 7 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 8 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 9 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 10 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 11 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 12 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 13 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 14 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 15 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 16 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 17 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 18 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 19 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 20 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 21 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 22 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 23 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 24 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 25 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 26 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 27 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 28 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 29 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 30 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 31 */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 32 ' ' (space) */
-    {0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00}, /* 33 '!' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 34 '"' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 35 '#' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 36 '$' */
-    {0x62, 0x66, 0x0C, 0x18, 0x30, 0x66, 0x46, 0x00}, /* 37 '%' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 38 '&' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 39 ''' */
-    {0x0C, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00}, /* 40 '(' */
-    {0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00}, /* 41 ')' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 42 '*' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 43 '+' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 44 ',' */
-    {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00}, /* 45 '-' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00}, /* 46 '.' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 47 '/' */
-    {0x3C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 48 '0' */
-    {0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00}, /* 49 '1' */
-    {0x3C, 0x66, 0x06, 0x0C, 0x18, 0x30, 0x7E, 0x00}, /* 50 '2' */
-    {0x3C, 0x66, 0x06, 0x1C, 0x06, 0x66, 0x3C, 0x00}, /* 51 '3' */
-    {0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C, 0x0C, 0x00}, /* 52 '4' */
-    {0x7E, 0x60, 0x7C, 0x06, 0x06, 0x66, 0x3C, 0x00}, /* 53 '5' */
-    {0x3C, 0x60, 0x60, 0x7C, 0x66, 0x66, 0x3C, 0x00}, /* 54 '6' */
-    {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00}, /* 55 '7' */
-    {0x3C, 0x66, 0x66, 0x3C, 0x66, 0x66, 0x3C, 0x00}, /* 56 '8' */
-    {0x3C, 0x66, 0x66, 0x3E, 0x06, 0x0C, 0x38, 0x00}, /* 57 '9' */
-    {0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00}, /* 58 ':' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 59 ';' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 60 '<' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 61 '=' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 62 '>' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 63 '?' */
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 64 '@' */
-    {0x18, 0x3C, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x00}, /* 65 'A' */
-    {0x7C, 0x66, 0x66, 0x7C, 0x66, 0x66, 0x7C, 0x00}, /* 66 'B' */
-    {0x3C, 0x66, 0x60, 0x60, 0x60, 0x66, 0x3C, 0x00}, /* 67 'C' */
-    {0x78, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0x78, 0x00}, /* 68 'D' */
-    {0x7E, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x7E, 0x00}, /* 69 'E' */
-    {0x7E, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x60, 0x00}, /* 70 'F' */
-    {0x3C, 0x66, 0x60, 0x6E, 0x66, 0x66, 0x3C, 0x00}, /* 71 'G' */
-    {0x66, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x66, 0x00}, /* 72 'H' */
-    {0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00}, /* 73 'I' */
-    {0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3C, 0x00}, /* 74 'J' */
-    {0x66, 0x6C, 0x78, 0x70, 0x78, 0x6C, 0x66, 0x00}, /* 75 'K' */
-    {0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x00}, /* 76 'L' */
-    {0x63, 0x77, 0x7F, 0x6B, 0x63, 0x63, 0x63, 0x00}, /* 77 'M' */
-    {0x66, 0x76, 0x7E, 0x7E, 0x6E, 0x66, 0x66, 0x00}, /* 78 'N' */
-    {0x3C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 79 'O' */
-    {0x7C, 0x66, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x00}, /* 80 'P' */
-    {0x3C, 0x66, 0x66, 0x66, 0x6A, 0x6C, 0x36, 0x00}, /* 81 'Q' */
-    {0x7C, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0x66, 0x00}, /* 82 'R' */
-    {0x3C, 0x66, 0x60, 0x3C, 0x06, 0x66, 0x3C, 0x00}, /* 83 'S' */
-    {0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00}, /* 84 'T' */
-    {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 85 'U' */
-    {0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x18, 0x00}, /* 86 'V' */
-    {0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00}, /* 87 'W' */
-    {0x66, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0x66, 0x00}, /* 88 'X' */
-    {0x66, 0x66, 0x66, 0x3C, 0x18, 0x18, 0x18, 0x00}, /* 89 'Y' */
-    {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x7E, 0x00}}; /* 90 'Z' */
+static const char* const VEHICLE_CLASS_NAMES[] = {"UNKNOWN", "BUS", "CAR", "TRUCK"};
+static const char* const BANANA_CLASS_NAMES[] = {"Overripe", "Ripe", "Rotten",
+                                                 "Unripe"};
+static const char* const TOOL_CLASS_NAMES[] = {"Bolt", "Hammer", "Nail", "Nut"};
+static const char* const RPS_CLASS_NAMES[] = {"PAPER", "ROCK", "SCISSORS", "UNKNOWN"};
+
+/**
+ * \brief Post-processing descriptor of a model
+ *
+ * The scale and zero point only apply to models that output int8 logits,
+ * i.e. that were exported without the dequantize of the output. Take them
+ * from the quantization parameters of the exported model output. The models
+ * below output float logits (dequantize in the graph, see
+ * ai_layer/model/REPORT.md) and leave the scale at 0, which refuses int8
+ * logits instead of decoding raw codes.
+ */
+typedef struct {
+    const char* const* class_names; /**< Class names, num_classes entries */
+    int      num_classes;           /**< Number of classes (at most NUM_CLASSES) */
+    int      output_index;          /**< Method output holding the logits */
+    bool     softmax;               /**< Logits need a softmax */
+    int      unknown_index;         /**< Class for "nothing recognised", -1 if none */
+    float    output_scale;          /**< Scale of int8 logits, 0 if not quantized */
+    int32_t  output_zero_point;     /**< Zero point of int8 logits */
+} model_desc_t;
+
+/** \brief Post-processing descriptors, indexed by model configuration */
+static const model_desc_t model_descs[] = {
+    /* VEHICLE_MODEL */         {VEHICLE_CLASS_NAMES, 4, 0, true, 0, 0.0f, 0},
+    /* BANANA_RIPENESS_MODEL */ {BANANA_CLASS_NAMES, 4, 0, true, -1, 0.0f, 0},
+    /* TOOL_MODEL */            {TOOL_CLASS_NAMES, 4, 0, true, -1, 0.0f, 0},
+    /* RPS_MODEL */             {RPS_CLASS_NAMES, 4, 0, true, 3, 0.0f, 0},
+};
+
+#define NUM_MODEL_CONFIGS (sizeof(model_descs) / sizeof(model_descs[0]))
+
+/** \brief Top-k result of the last inference */
+static runner_topk_t topk_result;
 
 /* ============================================================================
  * Static Helper Functions
@@ -359,150 +346,368 @@ const char* get_log_color(int idx) {
 }
 
 /**
- * \brief Draw a single character on an RGB image
- * \param[in,out] image      Pointer to image buffer (RGB888 format)
- * \param[in]     img_width  Image width in pixels
- * \param[in]     img_height Image height in pixels
- * \param[in]     x          X coordinate for character placement
- * \param[in]     y          Y coordinate for character placement
- * \param[in]     c          Character to draw
- * \param[in]     scale      Scaling factor for character size
+ * \brief Select the k largest logits, on float or int8 logits alike
+ * \tparam T Logit type
+ * \param[in]  logits Pointer to logit values array
+ * \param[in]  n      Number of elements
+ * \param[out] index  Indices of the ML_TOPK largest logits, largest first;
+ *                    the first of equal logits comes first
+ * \return Number of valid indices, min(n, ML_TOPK)
  */
-static void DrawChar(uint8_t* image, uint32_t img_width, uint32_t img_height,
-                     uint32_t x, uint32_t y, char c, uint32_t scale) {
-    /* Check if character is valid */
-    if (c < 0 || c >= ASCII_CHAR_COUNT) {
-        return;
+template <typename T>
+static int top_k(const T* logits, int n, uint8_t* index) {
+    int count = 0;
+
+    for (int i = 0; i < n; i++) {
+        int pos;
+
+        if (count < ML_TOPK) {
+            pos = count++;
+        } else if (logits[i] > logits[index[ML_TOPK - 1]]) {
+            pos = ML_TOPK - 1;
+        } else {
+            continue;
+        }
+
+        /* Insert, keeping the indices sorted by descending logit */
+        while ((pos > 0) && (logits[i] > logits[index[pos - 1]])) {
+            index[pos] = index[pos - 1];
+            pos--;
+        }
+        index[pos] = static_cast<uint8_t>(i);
     }
+    return count;
+}
 
-    const uint8_t* glyph = font_8x8[(int)c];
-    const uint32_t stride = img_width * BYTES_PER_PIXEL_RGB888;
-
-    /* 8x8 font: 8 rows, 8 columns per row */
-    for (uint32_t row = 0; row < FONT_HEIGHT; row++) {
-        uint8_t bits = glyph[row];
-        for (uint32_t col = 0; col < FONT_WIDTH; col++) {
-            /* Check if bit is set (MSB = leftmost pixel) */
-            if (bits & (FONT_MSB_MASK >> col)) {
-                for (uint32_t sy = 0; sy < scale; sy++) {
-                    for (uint32_t sx = 0; sx < scale; sx++) {
-                        uint32_t py = y + row * scale + sy;
-                        uint32_t px_x = x + col * scale + sx;
-
-                        /* Bounds checking */
-                        if (py >= img_height || px_x >= img_width) {
-                            continue;
-                        }
-
-                        uint8_t* px = image + (py * stride) + (px_x * 3);
-                        px[0] = 0;   /* Red */
-                        px[1] = 0;   /* Green */
-                        px[2] = 255; /* Blue */
-                    }
-                }
-            }
+/**
+ * \brief Apply softmax function to convert logits to probabilities
+ * \param[in]  logits Pointer to logit values array
+ * \param[out] probs  Pointer to output probability array
+ * \param[in]  n      Number of elements
+ */
+void softmax(const float* logits, float* probs, int n) {
+    float max_val = logits[0];
+    for (int i = 1; i < n; i++) {
+        if (logits[i] > max_val) {
+            max_val = logits[i];
         }
     }
+
+    float sum = 0.0f;
+    for (int i = 0; i < n; i++) {
+        probs[i] = expf(logits[i] - max_val);
+        sum += probs[i];
+    }
+
+    for (int i = 0; i < n; i++) {
+        probs[i] /= sum;
+    }
 }
 
 /**
- * \brief Draw text string on an RGB image
- * \param[in,out] imageBuffer Pointer to image buffer (RGB888 format)
- * \param[in]     img_width   Image width in pixels
- * \param[in]     img_height  Image height in pixels
- * \param[in]     text        Null-terminated text string to draw
- * \param[in]     x           X coordinate for text placement
- * \param[in]     y           Y coordinate for text placement
- * \param[in]     scale       Scaling factor for text size
+ * \brief Convert int8 logits to probabilities without a dequantize pass
+ *
+ * The softmax only needs the logit differences, so the zero point cancels
+ * and the scale is applied to the integer difference to the largest logit.
+ *
+ * \param[in]  logits Pointer to int8 logit values array
+ * \param[in]  n      Number of elements
+ * \param[in]  desc   Model descriptor (softmax, scale and zero point)
+ * \param[out] probs  Pointer to output probability array
  */
-static void DrawTextOnImage(uint8_t* imageBuffer, uint32_t img_width,
-                            uint32_t img_height, const char* text, uint32_t x,
-                            uint32_t y, uint32_t scale) {
-    const uint32_t char_w = FONT_WIDTH * scale; /* 8x8 font */
+static void int8_probs(const int8_t* logits, int n, const model_desc_t& desc,
+                       float* probs) {
+    if (!desc.softmax) {
+        for (int i = 0; i < n; i++) {
+            probs[i] = desc.output_scale *
+                       static_cast<float>(logits[i] - desc.output_zero_point);
+        }
+        return;
+    }
+
+    int8_t max_val = logits[0];
+    for (int i = 1; i < n; i++) {
+        if (logits[i] > max_val) {
+            max_val = logits[i];
+        }
+    }
+
+    float sum = 0.0f;
+    for (int i = 0; i < n; i++) {
+        probs[i] = expf(desc.output_scale *
+                        static_cast<float>(logits[i] - max_val));
+        sum += probs[i];
+    }
 
-    for (uint32_t i = 0; text[i] != '\0'; i++) {
-        DrawChar(imageBuffer, img_width, img_height, x + i * char_w, y, text[i],
-                 scale);
+    for (int i = 0; i < n; i++) {
+        probs[i] /= sum;
     }
 }
 
+/* ============================================================================
+ * Input Quantization
+ * ============================================================================
+ */
+
+#if ML_INPUT_FUSED_QUANT
+/** \brief Operator quantizing the model input */
+#define INPUT_QUANT_OP           "quantized_decomposed::quantize_per_tensor.out"
+
+/** \brief Buffer size of the kernel key of the input quantize call */
+#define INPUT_QUANT_KEY_SIZE     96U
+
 /**
- * \brief Draw classification label centered at bottom of image
- * \param[in,out] imageBuffer Pointer to image buffer (RGB888 format)
- * \param[in]     img_width   Image width in pixels
- * \param[in]     img_height  Image height in pixels
- * \param[in]     text        Null-terminated label text to draw
+ * \brief Input quantization of a model, read from its program.
+ *
+ * The scale, zero point and clamp range are the constant arguments of the
+ * quantize_per_tensor call that quantizes the method input, and target is
+ * the memory planned output of that call. preprocess() writes the quantized
+ * input straight into target, and the call is skipped for that output (see
+ * quantize_input_out()), so the float input of the model is never written.
  */
-void DrawClassLabelOnImage(uint8_t* imageBuffer, uint32_t img_width,
-                                  uint32_t img_height, const char* text) {
-    const uint32_t scale = FONT_SCALE;          /* 2x scaling */
-    const uint32_t char_w = FONT_WIDTH * scale; /* 16 pixels wide per char */
-    const uint32_t char_height = FONT_HEIGHT * scale; /* 16 pixels tall */
+typedef struct {
+    int8_t*  target;        /**< Planned output of the input quantize */
+    float    inv_scale;     /**< 1 / scale */
+    int32_t  zero_point;    /**< Quantization zero point */
+    int32_t  quant_min;     /**< Lower clamp value */
+    int32_t  quant_max;     /**< Upper clamp value */
+    char     kernel_key[INPUT_QUANT_KEY_SIZE]; /**< Kernel key of the call, referenced by the registry */
+} input_quant_t;
+
+/** \brief Input quantization of each loaded model */
+static input_quant_t input_quants[ML_MAX_MODELS];
 
-    uint32_t len = strlen(text);
-    uint32_t text_width = len * char_w;
+/** \brief Input quantization of the active model */
+static input_quant_t* input_quant = &input_quants[0];
 
-    /* Center horizontally in image */
-    uint32_t x_start = (img_width - text_width) / 2;
+/** \brief Per-channel uint8 → int8 table (normalisation + quantization) of each loaded model */
+static int8_t input_quant_luts[ML_MAX_MODELS][C][256];
 
-    /* Position from bottom with safe margin */
-    /* 224 - 16 - 8 = 200 */
-    uint32_t y_start = img_height - char_height - TEXT_BOTTOM_MARGIN;
+/** \brief Input lookup table of the active model */
+static int8_t (*input_quant_lut)[256] = input_quant_luts[0];
 
-    DrawTextOnImage(imageBuffer, img_width, img_height, text, x_start, y_start,
-                    scale);
+/** \brief quantize_per_tensor.out kernel of the ExecuTorch quantize operator component */
+static executorch::runtime::OpFunction quantize_per_tensor_out = nullptr;
+
+/**
+ * \brief Quantize one float value the same way quantize_per_tensor does
+ * \param[in] x Float value
+ * \return Quantized value clamped to [quant_min, quant_max]
+ */
+static inline int8_t quantize_value(float x) {
+    int32_t q = static_cast<int32_t>(nearbyintf(input_quant->inv_scale * x)) +
+                input_quant->zero_point;
+    if (q < input_quant->quant_min) {
+        q = input_quant->quant_min;
+    }
+    if (q > input_quant->quant_max) {
+        q = input_quant->quant_max;
+    }
+    return static_cast<int8_t>(q);
 }
 
 /**
- * \brief Find index of maximum value in probability array
- * \param[in]  probs      Pointer to probability array
- * \param[in]  n          Number of elements in array
- * \param[out] confidence Pointer to store maximum probability value
- * \return Index of maximum probability
+ * \brief quantize_per_tensor.out, registered for the kernel key of the input
+ *        quantize call.
+ *
+ * Returns early when the output is the input of the active model, which
+ * preprocess() has already written, and runs the stock kernel otherwise.
+ *
+ * \param[in]     context Kernel runtime context
+ * \param[in,out] stack   input, scale, zero_point, quant_min, quant_max,
+ *                        dtype, out, return value
  */
-static int argmax(const float* probs, int n, float* confidence) {
-    int idx = 0;
-    *confidence = probs[0];
+static void quantize_input_out(KernelRuntimeContext& context,
+                               Span<EValue*> stack) {
+    if ((stack.size() == 8) && stack[6]->isTensor() &&
+        (stack[6]->toTensor().const_data_ptr() == input_quant->target)) {
+        return;
+    }
+    quantize_per_tensor_out(context, stack);
+}
 
-    for (int i = 1; i < n; i++) {
-        if (probs[i] > *confidence) {
-            *confidence = probs[i];
-            idx = i;
+/**
+ * \brief Read the input quantization of a method from its program
+ *
+ * Looks for the quantize_per_tensor.out call whose input is the method
+ * input and takes its constant arguments, the planned address of its output
+ * and its kernel key into the state of the active model.
+ *
+ * \param[in] pte            Model PTE
+ * \param[in] method_name    Method name
+ * \param[in] planned_memory Planned memory of the method
+ * \return true if the method input is quantized to int8, false otherwise
+ */
+static bool read_input_quant(const void* pte, const char* method_name,
+                             HierarchicalAllocator& planned_memory) {
+    const executorch_flatbuffer::Program* program =
+        executorch_flatbuffer::GetProgram(pte);
+    const executorch_flatbuffer::ExecutionPlan* plan = nullptr;
+
+    for (const executorch_flatbuffer::ExecutionPlan* p : *program->execution_plan()) {
+        if ((p->name() != nullptr) && (strcmp(p->name()->c_str(), method_name) == 0)) {
+            plan = p;
         }
     }
-    return idx;
+    if ((plan == nullptr) || (plan->inputs() == nullptr) || (plan->inputs()->size() == 0) ||
+        (plan->chains() == nullptr) || (plan->operators() == nullptr) || (plan->values() == nullptr)) {
+        return false;
+    }
+
+    const auto* values = plan->values();
+    const int32_t input = plan->inputs()->Get(0);
+
+    for (const executorch_flatbuffer::Chain* chain : *plan->chains()) {
+        if (chain->instructions() == nullptr) {
+            continue;
+        }
+        for (const executorch_flatbuffer::Instruction* instr : *chain->instructions()) {
+            const executorch_flatbuffer::KernelCall* call = instr->instr_args_as_KernelCall();
+            if ((call == nullptr) || (call->args() == nullptr) || (call->args()->size() != 8) ||
+                (call->args()->Get(0) != input) ||
+                (static_cast<uint32_t>(call->op_index()) >= plan->operators()->size())) {
+                continue;
+            }
+            const executorch_flatbuffer::Operator* op = plan->operators()->Get(call->op_index());
+            if ((op->name() == nullptr) || (op->overload() == nullptr) ||
+                (strcmp(op->name()->c_str(), "quantized_decomposed::quantize_per_tensor") != 0) ||
+                (strcmp(op->overload()->c_str(), "out") != 0)) {
+                continue;
+            }
+
+            /* input, scale, zero_point, quant_min, quant_max, dtype, out, return value */
+            const executorch_flatbuffer::EValue* args[8];
+            executorch::runtime::TensorMeta metas[8];
+            size_t num_metas = 0;
+
+            for (uint32_t i = 0; i < 8U; i++) {
+                int32_t index = call->args()->Get(i);
+                if ((index < 0) || (static_cast<uint32_t>(index) >= values->size())) {
+                    return false;
+                }
+                args[i] = values->Get(index);
+                const executorch_flatbuffer::Tensor* tensor = args[i]->val_as_Tensor();
+                if (tensor != nullptr) {
+                    if (tensor->dim_order() == nullptr) {
+                        return false;
+                    }
+                    metas[num_metas++] = executorch::runtime::TensorMeta(
+                        static_cast<ScalarType>(tensor->scalar_type()),
+                        Span<executorch::aten::DimOrderType>(
+                            const_cast<executorch::aten::DimOrderType*>(tensor->dim_order()->data()),
+                            tensor->dim_order()->size()));
+                }
+            }
+
+            const executorch_flatbuffer::Tensor* out = args[6]->val_as_Tensor();
+            if ((args[1]->val_as_Double() == nullptr) || (args[2]->val_as_Int() == nullptr) ||
+                (args[3]->val_as_Int() == nullptr) || (args[4]->val_as_Int() == nullptr) ||
+                (out == nullptr) || (out->sizes() == nullptr) ||
+                (out->scalar_type() != executorch_flatbuffer::ScalarType::CHAR) ||
+                (out->allocation_info() == nullptr) ||
+                (out->allocation_info()->memory_id() == 0)) {
+                return false;
+            }
+
+            size_t numel = 1;
+            for (int32_t size : *out->sizes()) {
+                numel *= static_cast<size_t>(size);
+            }
+            const executorch_flatbuffer::AllocationDetails* alloc = out->allocation_info();
+            Result<void*> target = planned_memory.get_offset_address(
+                alloc->memory_id() - 1U,
+                static_cast<size_t>(alloc->memory_offset_low()) |
+                    (static_cast<size_t>(alloc->memory_offset_high()) << 32),
+                numel);
+            if (!target.ok() || (numel != static_cast<size_t>(C * H * W))) {
+                return false;
+            }
+
+            input_quant->target = static_cast<int8_t*>(target.get());
+            input_quant->inv_scale = 1.0f / static_cast<float>(args[1]->val_as_Double()->double_val());
+            input_quant->zero_point = static_cast<int32_t>(args[2]->val_as_Int()->int_val());
+            input_quant->quant_min = static_cast<int32_t>(args[3]->val_as_Int()->int_val());
+            input_quant->quant_max = static_cast<int32_t>(args[4]->val_as_Int()->int_val());
+            return executorch::runtime::internal::make_kernel_key_string(
+                       {metas, num_metas}, input_quant->kernel_key,
+                       sizeof(input_quant->kernel_key)) == Error::Ok;
+        }
+    }
+    return false;
 }
 
 /**
- * \brief Apply softmax function to convert logits to probabilities
- * \param[in]  logits Pointer to logit values array
- * \param[out] probs  Pointer to output probability array
- * \param[in]  n      Number of elements
+ * \brief Register quantize_input_out() for the kernel key of the active model
+ *
+ * The kernel of the quantize operator component stays registered as the
+ * fallback for all other calls. Models with the same kernel key share one
+ * registration.
  */
-void softmax(const float* logits, float* probs, int n) {
-    float max_val = logits[0];
-    for (int i = 1; i < n; i++) {
-        if (logits[i] > max_val) {
-            max_val = logits[i];
-        }
+static void register_input_quant_kernel(void) {
+    if (quantize_per_tensor_out == nullptr) {
+        Result<executorch::runtime::OpFunction> stock =
+            executorch::runtime::get_op_function_from_registry(INPUT_QUANT_OP);
+        ET_CHECK_MSG(stock.ok(), "Operator %s is not registered", INPUT_QUANT_OP);
+        quantize_per_tensor_out = stock.get();
     }
 
-    float sum = 0.0f;
-    for (int i = 0; i < n; i++) {
-        probs[i] = expf(logits[i] - max_val);
-        sum += probs[i];
+    for (const Kernel& kernel : executorch::runtime::get_registered_kernels()) {
+        if ((strcmp(kernel.name_, INPUT_QUANT_OP) == 0) &&
+            !kernel.kernel_key_.is_fallback() &&
+            (strcmp(kernel.kernel_key_.data(), input_quant->kernel_key) == 0)) {
+            return;
+        }
     }
 
-    for (int i = 0; i < n; i++) {
-        probs[i] /= sum;
+    Error status = executorch::runtime::register_kernel(
+        Kernel(INPUT_QUANT_OP, executorch::runtime::KernelKey(input_quant->kernel_key),
+               quantize_input_out));
+    ET_CHECK_MSG(status == Error::Ok,
+                 "Registering %s failed with status 0x%" PRIx32, INPUT_QUANT_OP,
+                 (uint32_t)status);
+}
+
+/**
+ * \brief Build the per-channel input lookup table of the active model
+ */
+static void build_input_quant_lut(void) {
+    for (int c = 0; c < C; ++c) {
+        for (int v = 0; v < 256; ++v) {
+            /* Same float math as the non-fused path, then quantize */
+            float x = (v / 255.0f - mean[c]) / stdv[c];
+            input_quant_lut[c][v] = quantize_value(x);
+        }
     }
 }
 
+/**
+ * \brief Write the quantized SqueezeNet input straight from an RGB888 image
+ * \param[in] image Pointer to input image data (HWC RGB format)
+ */
+void preprocess(const uint8_t* image) {
+    int8_t* dst_r = input_quant->target;
+    int8_t* dst_g = dst_r + H * W;
+    int8_t* dst_b = dst_g + H * W;
+    const int8_t* lut_r = input_quant_lut[0];
+    const int8_t* lut_g = input_quant_lut[1];
+    const int8_t* lut_b = input_quant_lut[2];
+
+    /* image layout: HWC, RGBRGB... → planar int8 CHW */
+    for (int i = 0; i < H * W; ++i) {
+        dst_r[i] = lut_r[image[0]];
+        dst_g[i] = lut_g[image[1]];
+        dst_b[i] = lut_b[image[2]];
+        image += C;
+    }
+}
+#else
 /**
  * \brief Prepare image input tensor for SqueezeNet model
  * \param[in] image Pointer to input image data (HWC RGB format)
  */
 void preprocess(const uint8_t* image) {
+    float* input = input_binding->target->mutable_data<float>();
+
     /* image layout: HWC, RGBRGB... */
     for (int c = 0; c < C; ++c) {
         for (int h = 0; h < H; ++h) {
@@ -516,11 +721,12 @@ void preprocess(const uint8_t* image) {
                 /* Normalize (ImageNet) */
                 x = (x - mean[c]) / stdv[c];
 
-                input_tensor_data[nchw_index] = x;
+                input[nchw_index] = x;
             }
         }
     }
 }
+#endif
 
 /* ============================================================================
  * ExecuTorch Platform Functions
@@ -545,6 +751,19 @@ void et_pal_emit_log_message(ET_UNUSED et_timestamp_t timestamp,
             function, message);
 }
 
+/**
+ * \brief Report how the Ethos-U backend binds a delegate input or output
+ * \param[in] is_output 1 for an output, 0 for an input
+ * \param[in] index     Input or output index of the delegate
+ * \param[in] reason    nullptr if in place in scratch, else why it is copied
+ */
+extern "C" void EthosUBackend_io_binding(int is_output, int index,
+                                         const char* reason) {
+    printf("Ethos-U %s %d: %s%s\n", is_output ? "output" : "input", index,
+           (reason == nullptr) ? "zero-copy" : "copied, ",
+           (reason == nullptr) ? "" : reason);
+}
+
 /**
  * \brief Allocate dynamic memory (not used in bare-metal)
  * \param[in] size Size in bytes to allocate
@@ -596,6 +815,16 @@ class Box {
         has_value = true;
     }
 
+    /**
+     * \brief Destruct the contained object, if any
+     */
+    void clear() {
+        if (has_value) {
+            ptr()->~T();
+            has_value = false;
+        }
+    }
+
     /**
      * \brief Get reference to contained object
      * \return Reference to contained object
@@ -637,60 +866,82 @@ class Box {
     const T* ptr() const { return reinterpret_cast<const T*>(mem); }
 };
 
-/**
- * \brief Update input tensors with new data
- * \param[in,out] method        Method instance
- * \param[in]     allocator     Memory allocator
- * \param[in]     input_buffers Vector of input buffer pointers and sizes
- * \return Error::Ok on success, error code otherwise
+/*
+ * Method::step() and Method::reset_execution() are experimental and
+ * Method::get_inputs() is deprecated in this ExecuTorch release. The runner
+ * only calls them through these wrappers, which keep the deprecation
+ * warnings out of the build.
  */
-Error update_input_tensors(
-    Method& method, MemoryAllocator& allocator,
-    const std::vector<std::pair<char*, size_t>>& input_buffers) {
-    MethodMeta method_meta = method.method_meta();
-    size_t num_inputs = method_meta.num_inputs();
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
-    /* Use stack allocation instead: */
-    std::vector<EValue> input_evalues(num_inputs);
-
-    Error err = method.get_inputs(input_evalues.data(), num_inputs);
-    ET_CHECK_OK_OR_RETURN_ERROR(err);
+/** \brief Method::step(): execute the next instruction */
+Error method_step(Method& method) {
+    return method.step();
+}
 
-    for (size_t i = 0; i < num_inputs; i++) {
-        auto tag = method_meta.input_tag(i);
-        ET_CHECK_OK_OR_RETURN_ERROR(tag.error());
+/** \brief Method::reset_execution(): rewind after EndOfMethod */
+Error method_reset_execution(Method& method) {
+    return method.reset_execution();
+}
 
-        if (tag.get() != Tag::Tensor) {
-            printf("Skipping non-tensor input %u\n", i);
-            continue;
-        }
+/** \brief Method::get_inputs(): copy the input values */
+Error method_get_inputs(Method& method, Span<EValue> input_evalues) {
+    return method.get_inputs(input_evalues.data(), input_evalues.size());
+}
 
-        if (i < input_buffers.size()) {
-            auto [buffer, buffer_size] = input_buffers.at(i);
-            Result<TensorInfo> tensor_meta = method_meta.input_tensor_meta(i);
-            ET_CHECK_OK_OR_RETURN_ERROR(tensor_meta.error());
+#pragma GCC diagnostic pop
 
-            if (buffer_size != tensor_meta->nbytes()) {
-                printf("Input size (%zu) and tensor size (%zu) mismatch!\n",
-                       buffer_size, tensor_meta->nbytes());
-                return Error::InvalidArgument;
-            }
-
-            if (input_evalues[i].isTensor()) {
-                Tensor& tensor = input_evalues[i].toTensor();
-                std::memcpy(tensor.mutable_data_ptr<int8_t>(), buffer,
-                            buffer_size);
-            }
-        }
+/**
+ * \brief Allocate a list of values from the method allocator
+ * \param[in] allocator Method allocator
+ * \param[in] n         Number of values
+ * \return Span of n default constructed values, empty on failure
+ */
+Span<EValue> allocate_evalues(MemoryAllocator& allocator, size_t n) {
+    if (n == 0) {
+        return {};
+    }
+    EValue* values = allocator.allocateList<EValue>(n);
+    if (values == nullptr) {
+        return {};
+    }
+    for (size_t i = 0; i < n; i++) {
+        new (&values[i]) EValue();
     }
+    return {values, n};
+}
 
-    return Error::Ok;
+#if !ML_INPUT_FUSED_QUANT
+/**
+ * \brief Bind a tensor input of the method to an application-owned buffer
+ *
+ * The buffer is described with the shape and layout of the method's input
+ * tensor. Method::set_input() shares it with the method instead of copying
+ * when the input is not memory planned.
+ *
+ * \param[in,out] method Method instance, not mid execution
+ * \param[in]     index  Input index
+ * \param[in]     input  Input tensor of the method
+ * \param[in]     buffer Input data, input.nbytes() bytes
+ * \return Error::Ok on success, error code otherwise
+ */
+Error bind_input_tensor(Method& method, size_t index, const Tensor& input,
+                        void* buffer) {
+    executorch::aten::TensorImpl impl(
+        input.scalar_type(), input.dim(),
+        const_cast<executorch::aten::SizesType*>(input.sizes().data()), buffer,
+        const_cast<executorch::aten::DimOrderType*>(input.dim_order().data()),
+        const_cast<executorch::aten::StridesType*>(input.strides().data()));
+
+    return method.set_input(EValue(Tensor(&impl)), index);
 }
+#endif
 
 } /* namespace - internal helpers end here */
 
 /**
- * \brief Runner context holding all state for model execution
+ * \brief Runner context holding all state for execution of one model
  */
 struct RunnerContext {
     RunnerContext() = default;
@@ -698,39 +949,156 @@ struct RunnerContext {
     RunnerContext& operator=(const RunnerContext& ctx) = delete;
 
     const char* method_name = nullptr;
+    size_t index = 0;
+    int model_config = RPS_MODEL;
     size_t planned_buffer_memsize = 0;
     size_t method_loaded_memsize = 0;
     size_t executor_membase = 0;
     size_t program_data_len = 0;
     size_t input_memsize = 0;
     size_t pte_size = 0;
+    const void* pte = nullptr;
     bool bundle_io = false;
-    Box<ArmMemoryAllocator> method_allocator;
-    Box<ArmMemoryAllocator> temp_allocator;
+    Program* program = nullptr;
+    uint8_t* method_memory = nullptr; /* Memory taken by loading the method */
+    size_t method_memory_size = 0;
+    ArmMemoryAllocator* method_allocator = nullptr; /* Shared by all models */
+    ArmMemoryAllocator* temp_allocator = nullptr;   /* Shared by all models */
+    Box<ArmMemoryAllocator> method_region;     /* Method memory, for reloading */
+    Box<HierarchicalAllocator> planned_memory; /* Referenced by the method */
+    Box<MemoryManager> memory_manager;         /* Referenced by the method */
     Box<Result<Method>> method;
+    Span<EValue> inputs;  /* Input values, sized from MethodMeta at init */
+    Span<EValue> outputs; /* Output values, sized from MethodMeta at init */
 };
 
+/** \brief Contexts of the loaded models */
+static RunnerContext runner_contexts[ML_MAX_MODELS];
+
+/** \brief Number of loaded models */
+static size_t runner_num_models = 0;
+
+/** \brief Index of the active model */
+static size_t runner_active_model = 0;
+
+/** \brief Method and temp allocators, shared by all models */
+static Box<ArmMemoryAllocator> shared_method_allocator;
+static Box<ArmMemoryAllocator> shared_temp_allocator;
+
+/** \brief Planned-memory arena size, the planned memory of the largest model */
+static size_t planned_arena_size = 0;
+
+/** \brief Ethos-U scratch arena size, the scratch of the largest delegate */
+static size_t scratch_arena_size = 0;
+
 RunnerContext* runner_context_instance(void) {
-    static RunnerContext instance;
-    return &instance;
+    return &runner_contexts[runner_active_model];
 }
 
 /**
- * \brief Initialize runner context and load model
- * \param[in,out] ctx           Runner context
- * \param[in]     input_buffers Input buffer specifications
- * \param[in]     pte_size      Size of PTE file
- * \param[in]     program       Loaded program instance
+ * \brief Make a model the active one, without checking that it is loaded
+ * \param[in] index Model index
  */
-void runner_init(RunnerContext& ctx,
-                 std::vector<std::pair<char*, size_t>> input_buffers,
-                 size_t pte_size, Program* program) {
-    printf("Model buffer loaded, has %u methods\n", program->num_methods());
-    {
-        const auto method_name_result = program->get_method_name(0);
-        ET_CHECK_MSG(method_name_result.ok(), "Program has no methods");
-        ctx.method_name = *method_name_result;
+static void activate_model(size_t index) {
+    runner_active_model = index;
+    model_config = runner_contexts[index].model_config;
+#if ML_INPUT_FUSED_QUANT
+    input_quant = &input_quants[index];
+    input_quant_lut = input_quant_luts[index];
+#else
+    input_binding = &input_bindings[index];
+#endif
+}
+
+/**
+ * \brief Size of the planned memory of a method, buffers placed back to back
+ * \param[in] method_meta Method metadata
+ * \return Size in bytes, including the alignment of each buffer
+ */
+static size_t planned_memory_size(const MethodMeta& method_meta) {
+    size_t size = 0;
+
+    for (size_t id = 0; id < method_meta.num_memory_planned_buffers(); ++id) {
+        /* Ethos-U driver requires 16 bit alignment. */
+        size = ((size + 15U) & ~15U) +
+               static_cast<size_t>(
+                   method_meta.memory_planned_buffer_size(id).get());
     }
+    return size;
+}
+
+/**
+ * \brief Event tracer recording the events of the loaded methods
+ * \return Event tracer, nullptr without ET_EVENT_TRACER_ENABLED
+ */
+static executorch::runtime::EventTracer* method_event_tracer(void) {
+#if defined(ET_EVENT_TRACER_ENABLED)
+    return &event_tracer;
+#else
+    return nullptr;
+#endif
+}
+
+#if ML_INPUT_FUSED_QUANT
+/**
+ * \brief Mark the model input as set without writing it
+ *
+ * The float input is not used: preprocess() writes the quantized input and
+ * its quantize call is skipped.
+ *
+ * \param[in,out] ctx Runner context, method loaded
+ * \return Error::Ok on success, error code otherwise
+ */
+static Error bind_model_input(RunnerContext& ctx) {
+    return method_get_inputs(*ctx.method.value(), ctx.inputs);
+}
+#else
+/**
+ * \brief Point the pre-processing of a model at its input tensor
+ *
+ * A memory planned input is pre-processed in place. An input that is not
+ * memory planned is bound to input_tensor_data first; the method keeps
+ * sharing that buffer for every execution.
+ *
+ * \param[in,out] ctx Runner context, method loaded
+ * \return Error::Ok on success, error code otherwise
+ */
+static Error bind_model_input(RunnerContext& ctx) {
+    Method& method = *ctx.method.value();
+    Error status = method_get_inputs(method, ctx.inputs);
+
+    if ((status == Error::Ok) &&
+        !method.method_meta().input_tensor_meta(0)->is_memory_planned()) {
+        status = bind_input_tensor(method, 0, ctx.inputs[0].toTensor(),
+                                   input_tensor_data);
+        if (status == Error::Ok) {
+            status = method_get_inputs(method, ctx.inputs);
+        }
+    }
+    if (status == Error::Ok) {
+        input_bindings[ctx.index].target =
+            ctx.inputs[0].toTensor().unsafeGetTensorImpl();
+    }
+    return status;
+}
+#endif
+
+/**
+ * \brief Load the method of one model into its runner context
+ *
+ * The planned buffers of the method are placed at the start of the shared
+ * planned-memory arena, overlaying the planned buffers of the other models.
+ * Everything else the method needs during execution (planned buffer spans,
+ * memory manager, input and output value lists) is allocated here from the
+ * shared method allocator pool or held in the context, so that inference
+ * does not allocate any memory.
+ *
+ * \param[in,out] ctx           Runner context, method_name set
+ * \param[in]     program       Loaded program instance
+ * \param[in]     planned_arena Shared planned-memory arena
+ */
+static void load_model(RunnerContext& ctx, Program* program,
+                       uint8_t* planned_arena) {
     printf("Running method %s\n", ctx.method_name);
 
     Result<MethodMeta> method_meta = program->method_meta(ctx.method_name);
@@ -739,65 +1107,228 @@ void runner_init(RunnerContext& ctx,
                (unsigned int)method_meta.error());
     }
 
-    printf("Setup Method allocator pool. Size: %u bytes.\n",
-           method_allocation_pool_size);
-
-    ctx.method_allocator.reset(method_allocation_pool_size,
-                               method_allocation_pool);
-
-    std::vector<uint8_t*> planned_buffers;
-    std::vector<Span<uint8_t>> planned_spans;
     size_t num_memory_planned_buffers =
         method_meta->num_memory_planned_buffers();
 
-    size_t planned_buffer_membase = ctx.method_allocator->used_size();
+    /* Spans of the planned buffers, referenced by the planned memory */
+    Span<uint8_t>* planned_spans =
+        ctx.method_allocator->allocateList<Span<uint8_t>>(
+            num_memory_planned_buffers);
+    ET_CHECK_MSG(
+        (planned_spans != nullptr) || (num_memory_planned_buffers == 0),
+        "Could not allocate memory for %u planned buffer spans",
+        num_memory_planned_buffers);
+
+    size_t planned_offset = 0;
 
     for (size_t id = 0; id < num_memory_planned_buffers; ++id) {
         size_t buffer_size = static_cast<size_t>(
             method_meta->memory_planned_buffer_size(id).get());
         printf("Setting up planned buffer %u, size %u\n", id, buffer_size);
 
-        /* Move to it's own allocator when MemoryPlanner is in place. */
         /* Ethos-U driver requires 16 bit alignment. */
-        uint8_t* buffer = reinterpret_cast<uint8_t*>(
-            ctx.method_allocator->allocate(buffer_size, 16UL));
-        ET_CHECK_MSG(
-            buffer != nullptr,
-            "Could not allocate memory for memory planned buffer size %u",
-            buffer_size);
-        planned_buffers.push_back(buffer);
-        planned_spans.push_back({planned_buffers.back(), buffer_size});
+        planned_offset = (planned_offset + 15U) & ~15U;
+        new (&planned_spans[id])
+            Span<uint8_t>(planned_arena + planned_offset, buffer_size);
+        planned_offset += buffer_size;
     }
 
-    ctx.planned_buffer_memsize =
-        ctx.method_allocator->used_size() - planned_buffer_membase;
+    ctx.planned_buffer_memsize = planned_offset;
 
-    HierarchicalAllocator planned_memory(
-        {planned_spans.data(), planned_spans.size()});
+    /* The method keeps pointers to the memory manager and planned memory */
+    ctx.planned_memory.reset(
+        Span<Span<uint8_t>>(planned_spans, num_memory_planned_buffers));
 
-    ctx.temp_allocator.reset(temp_allocation_pool_size, temp_allocation_pool);
+    ctx.memory_manager.reset(ctx.method_allocator,
+                             &ctx.planned_memory.value(),
+                             ctx.temp_allocator);
 
-    MemoryManager memory_manager(&ctx.method_allocator.value(), &planned_memory,
-                                 &ctx.temp_allocator.value());
+#if ML_INPUT_FUSED_QUANT
+    /* Kernels are resolved when the method is loaded, register the skip first */
+    ET_CHECK_MSG(read_input_quant(ctx.pte, ctx.method_name, ctx.planned_memory.value()),
+                 "Model input is not quantized to int8 by quantize_per_tensor");
+    build_input_quant_lut();
+    register_input_quant_kernel();
+    {
+        uint32_t scale_e6 = (uint32_t)((1000000.0f / input_quant->inv_scale) + 0.5f);
+        printf("Fused input quantization: scale %u.%06u, zero point %d\n",
+               (unsigned int)(scale_e6 / 1000000U), (unsigned int)(scale_e6 % 1000000U),
+               (int)input_quant->zero_point);
+    }
+#endif
 
     size_t method_loaded_membase = ctx.method_allocator->used_size();
 
-    executorch::runtime::EventTracer* event_tracer_ptr = nullptr;
+    /* Cursor of the method allocator, start of the memory of the method */
+    ctx.program = program;
+    ctx.method_memory =
+        static_cast<uint8_t*>(ctx.method_allocator->allocate(0U, 1U));
 
-    ctx.method.reset(program->load_method(ctx.method_name, &memory_manager,
-                                          event_tracer_ptr));
+    ctx.method.reset(program->load_method(
+        ctx.method_name, &ctx.memory_manager.value(), method_event_tracer()));
 
     if (!ctx.method->ok()) {
         printf("Loading of method %s failed with status 0x%" PRIx32 "\n",
                ctx.method_name, (uint32_t)ctx.method->error());
     }
+    ctx.method_memory_size = static_cast<size_t>(
+        static_cast<uint8_t*>(ctx.method_allocator->allocate(0U, 1U)) -
+        ctx.method_memory);
     ctx.method_loaded_memsize =
         ctx.method_allocator->used_size() - method_loaded_membase;
     printf("Method '%s' loaded.\n", ctx.method_name);
 
+    /* Input and output value lists, reused by every inference */
+    {
+        size_t input_membase = ctx.method_allocator->used_size();
+        size_t num_inputs = method_meta->num_inputs();
+        size_t num_outputs = method_meta->num_outputs();
+
+        ctx.inputs = allocate_evalues(*ctx.method_allocator, num_inputs);
+        ctx.outputs = allocate_evalues(*ctx.method_allocator, num_outputs);
+        ET_CHECK_MSG((ctx.inputs.size() == num_inputs) &&
+                         (ctx.outputs.size() == num_outputs),
+                     "Could not allocate memory for %u inputs, %u outputs",
+                     num_inputs, num_outputs);
+        ctx.input_memsize = ctx.method_allocator->used_size() - input_membase;
+    }
+
+#if !ML_INPUT_FUSED_QUANT
+    /* Pre-process in place: into the planned input, else into the bound buffer */
+    {
+        Result<TensorInfo> tensor_meta = method_meta->input_tensor_meta(0);
+        ET_CHECK_MSG(tensor_meta.ok() &&
+                         tensor_meta->scalar_type() == ScalarType::Float &&
+                         tensor_meta->nbytes() == sizeof(float) * C * H * W,
+                     "Model input is not a float tensor of %u bytes",
+                     sizeof(float) * C * H * W);
+
+        Error status = bind_model_input(ctx);
+        ET_CHECK_MSG(status == Error::Ok,
+                     "Binding the model input failed with status 0x%" PRIx32,
+                     (uint32_t)status);
+        if (tensor_meta->is_memory_planned()) {
+            printf("Model input is memory planned, pre-processed in place\n");
+        } else {
+            printf("Model input bound to the input buffer without copy\n");
+        }
+    }
+#endif
+
+#if ML_INPUT_FUSED_QUANT
+    {
+        Error status = bind_model_input(ctx);
+        ET_CHECK_MSG(status == Error::Ok,
+                     "Binding the model input failed with status 0x%" PRIx32,
+                     (uint32_t)status);
+        printf("Model input quantized by pre-processing\n");
+    }
+#endif
+
     printf("Model initialized. Ready for inference.\n");
+}
 
-    ctx.executor_membase = ctx.method_allocator->used_size();
+size_t runner_init_models(const runner_model_t* models, size_t num_models) {
+    ET_CHECK_MSG((num_models > 0) && (num_models <= ML_MAX_MODELS),
+                 "Number of models %u out of range 1 .. %u", num_models,
+                 (size_t)ML_MAX_MODELS);
+
+    printf("Setup Method allocator pool. Size: %u bytes.\n",
+           method_allocation_pool_size);
+
+    shared_method_allocator.reset(method_allocation_pool_size,
+                                  method_allocation_pool);
+    shared_temp_allocator.reset(temp_allocation_pool_size,
+                                temp_allocation_pool);
+
+    /* Size the planned-memory arena for the largest model */
+    planned_arena_size = 0;
+    for (size_t i = 0; i < num_models; ++i) {
+        RunnerContext& ctx = runner_contexts[i];
+        Program* program = models[i].program;
+
+        printf("Model %u buffer loaded, has %u methods\n", i,
+               program->num_methods());
+
+        const auto method_name_result = program->get_method_name(0);
+        ET_CHECK_MSG(method_name_result.ok(), "Program has no methods");
+
+        Result<MethodMeta> method_meta =
+            program->method_meta(*method_name_result);
+        ET_CHECK_MSG(method_meta.ok(),
+                     "Failed to get method_meta for %s: 0x%" PRIx32,
+                     *method_name_result, (uint32_t)method_meta.error());
+
+        ctx.method_name = *method_name_result;
+        ctx.index = i;
+        ctx.model_config = models[i].config;
+        ET_CHECK_MSG((models[i].config >= 0) &&
+                         (models[i].config < (int)NUM_MODEL_CONFIGS),
+                     "Invalid model configuration %d", models[i].config);
+        ctx.pte_size = models[i].pte_size;
+        ctx.pte = models[i].pte;
+        ctx.method_allocator = &shared_method_allocator.value();
+        ctx.temp_allocator = &shared_temp_allocator.value();
+
+        size_t size = planned_memory_size(method_meta.get());
+        if (size > planned_arena_size) {
+            planned_arena_size = size;
+        }
+    }
+
+    /* Ethos-U driver requires 16 bit alignment. */
+    uint8_t* planned_arena = reinterpret_cast<uint8_t*>(
+        shared_method_allocator->allocate(planned_arena_size, 16UL));
+    ET_CHECK_MSG((planned_arena != nullptr) || (planned_arena_size == 0),
+                 "Could not allocate memory for planned-memory arena size %u",
+                 planned_arena_size);
+    printf("Planned-memory arena: %u bytes, shared by %u model(s)\n",
+           planned_arena_size, num_models);
+
+    /* Load each method with its own input state active */
+    for (size_t i = 0; i < num_models; ++i) {
+        activate_model(i);
+        load_model(runner_contexts[i], models[i].program, planned_arena);
+    }
+    runner_num_models = num_models;
+
+    /* One Ethos-U scratch for all delegates, sized once they are all loaded */
+    scratch_arena_size = 0;
+#if defined(ET_ARM_ETHOSU_ZERO_COPY_IO)
+    scratch_arena_size = EthosUBackend_scratch_size();
+    /* Ethos-U driver requires 16 bit alignment. */
+    uint8_t* scratch_arena = reinterpret_cast<uint8_t*>(
+        shared_method_allocator->allocate(scratch_arena_size, 16UL));
+    ET_CHECK_MSG((scratch_arena != nullptr) || (scratch_arena_size == 0),
+                 "Could not allocate memory for Ethos-U scratch arena size %u",
+                 scratch_arena_size);
+    ET_CHECK_MSG(EthosUBackend_set_scratch(scratch_arena, scratch_arena_size) == 0,
+                 "Could not set the Ethos-U scratch arena");
+    printf("Ethos-U scratch arena: %u bytes, shared by %u model(s)\n",
+           scratch_arena_size, num_models);
+#endif
+
+    for (size_t i = 0; i < num_models; ++i) {
+        runner_contexts[i].executor_membase =
+            shared_method_allocator->used_size();
+    }
+
+    activate_model(0);
+    return num_models;
+}
+
+size_t runner_model_count(void) {
+    return runner_num_models;
+}
+
+RunnerContext* runner_select_model(size_t index) {
+    if (index >= runner_num_models) {
+        return nullptr;
+    }
+    if (index != runner_active_model) {
+        activate_model(index);
+    }
+    return &runner_contexts[index];
 }
 
 /**
@@ -810,6 +1341,10 @@ void log_mem_status(RunnerContext& ctx) {
 
     printf("model_pte_program_size:     %u bytes.\n", ctx.program_data_len);
     printf("model_pte_loaded_size:      %u bytes.\n", ctx.pte_size);
+    printf("planned_arena:             %u bytes, %u model(s)\n",
+           planned_arena_size, runner_num_models);
+    printf("ethosu_scratch_arena:      %u bytes, %u model(s)\n",
+           scratch_arena_size, runner_num_models);
     if (ctx.method_allocator->size() != 0) {
         size_t method_allocator_used = ctx.method_allocator->used_size();
         printf("method_allocator_used:     %u / %u  free: %u ( used: %u %% )\n",
@@ -825,154 +1360,303 @@ void log_mem_status(RunnerContext& ctx) {
     }
     if (ctx.temp_allocator->size() > 0) {
         printf("temp_allocator:            %u\n", ctx.temp_allocator->size());
+        printf("temp_allocator_peak:       %u bytes\n",
+               ctx.temp_allocator->peak_used_size());
     }
 }
 
 /**
- * \brief Print and process model output tensors
+ * \brief Decode the model output into the result of the active model
+ *
+ * Driven by the descriptor of the active model: takes the logits from the
+ * configured output, selects the top-k classes on the raw float or int8
+ * logits, converts the logits to class probabilities and fills the compact
+ * top-k record, the class probabilities and the output label.
+ *
  * \param[in] ctx Runner context
  */
 void print_outputs(RunnerContext& ctx) {
-    std::vector<EValue> outputs(ctx.method.value()->outputs_size());
+    const model_desc_t& desc = model_descs[model_config];
+    Span<EValue> outputs = ctx.outputs;
+    uint8_t top[ML_TOPK];
+    int count;
 
     Error status =
         ctx.method.value()->get_outputs(outputs.data(), outputs.size());
     ET_CHECK(status == Error::Ok);
 
-    for (int i = 0; i < outputs.size(); ++i) {
-        if (outputs[i].isTensor()) {
-            Tensor tensor = outputs[i].toTensor();
-            if (tensor.scalar_type() != ScalarType::Float) {
-                continue;
-            }
+    if ((static_cast<size_t>(desc.output_index) >= outputs.size()) ||
+        !outputs[desc.output_index].isTensor()) {
+        printf("Output[%d]: Not Tensor\n", desc.output_index);
+        return;
+    }
 
-            const float* logits = tensor.const_data_ptr<float>();
-            int numel = tensor.numel();
-
-            float probs[NUM_CLASSES];
-            float confidence;
-            int predicted_idx;
-
-            softmax(logits, probs, numel);
-            memcpy(class_probs, probs, sizeof(class_probs));
-            predicted_idx = argmax(probs, numel, &confidence);
-
-            if (model_config == VEHICLE_MODEL) {
-                const char* color = get_log_color(predicted_idx);
-                printf("\nPost-processed output:\n");
-                printf("Predicted class : %s%s%s\n", color,
-                       VEHICLE_CLASS_NAMES[predicted_idx], COLOR_RESET);
-                printf("Confidence      : %.2f %%\n", confidence * PERCENT_SCALE);
-                conf_int = (int)(confidence * PERCENT_SCALE);
-                conf_score = confidence * PERCENT_SCALE;
-                strncpy(label_name, VEHICLE_CLASS_NAMES[predicted_idx],
-                        sizeof(label_name) - 1);
-                label_name[sizeof(label_name) - 1] = '\0';
-                strncpy(output_label.label_name,
-                        VEHICLE_CLASS_NAMES[predicted_idx],
-                        sizeof(output_label.label_name) - 1);
-                output_label.label_name[sizeof(output_label.label_name) - 1] =
-                    '\0';
-                output_label.confidence = conf_score;
-
-                if (strcmp(label_name, "UNKNOWN") == 0) {
-                    classify_object = false;
-                } else {
-                    classify_object = true;
-                }
+    Tensor tensor = outputs[desc.output_index].toTensor();
+    const int n = desc.num_classes;
 
-            } else if (model_config == BANANA_RIPENESS_MODEL) {
-                const char* color = get_log_color(predicted_idx);
-                printf("\nPost-processed output:\n");
-                printf("Predicted class : %s%s%s\n", color,
-                       BANANA_CLASS_NAMES[predicted_idx], COLOR_RESET);
-                printf("Confidence      : %.2f %%\n", confidence * PERCENT_SCALE);
-                conf_score = confidence * PERCENT_SCALE;
-                strncpy(label_name, BANANA_CLASS_NAMES[predicted_idx],
-                        sizeof(label_name) - 1);
-                label_name[sizeof(label_name) - 1] = '\0';
-                strncpy(output_label.label_name,
-                        VEHICLE_CLASS_NAMES[predicted_idx],
-                        sizeof(output_label.label_name) - 1);
-                output_label.label_name[sizeof(output_label.label_name) - 1] =
-                    '\0';
-                output_label.confidence = conf_score;
-            } else if (model_config == TOOL_MODEL) {
-                const char* color = get_log_color(predicted_idx);
-                printf("\nPost-processed output:\n");
-                printf("Predicted class : %s%s%s\n", color,
-                       TOOL_CLASS_NAMES[predicted_idx], COLOR_RESET);
-                printf("Confidence      : %.2f %%\n", confidence * PERCENT_SCALE);
-                conf_score = confidence * PERCENT_SCALE;
-                strncpy(label_name, TOOL_CLASS_NAMES[predicted_idx],
-                        sizeof(label_name) - 1);
-                label_name[sizeof(label_name) - 1] = '\0';
-                strncpy(output_label.label_name,
-                        VEHICLE_CLASS_NAMES[predicted_idx],
-                        sizeof(output_label.label_name) - 1);
-                output_label.label_name[sizeof(output_label.label_name) - 1] =
-                    '\0';
-                output_label.confidence = conf_score;
-            } else if (model_config == RPS_MODEL) {
-                const char* color = get_log_color(predicted_idx);
-                if (predicted_idx < (NUM_CLASSES - 1)) {
-                    // To reduce clutter, print predicted class and confidence only if predicted class is different then UNKNOWN
-                    printf("\nPost-processed output:\n");
-                    printf("Predicted class : %s%s%s\n", color,
-                           RPS_CLASS_NAMES[predicted_idx], COLOR_RESET);
-                    printf("Confidence      : %.2f %%\n", confidence * PERCENT_SCALE);
-                }
-                conf_score = confidence * PERCENT_SCALE;
-                conf_int = (int)(confidence * PERCENT_SCALE);
-                strncpy(label_name, RPS_CLASS_NAMES[predicted_idx],
-                        sizeof(label_name) - 1);
-                label_name[sizeof(label_name) - 1] = '\0';
-                strncpy(output_label.label_name,
-                        RPS_CLASS_NAMES[predicted_idx],
-                        sizeof(output_label.label_name) - 1);
-                output_label.label_name[sizeof(output_label.label_name) - 1] =
-                    '\0';
-                output_label.confidence = conf_score;
-            } else {
-                printf("\nPost-processed output:\n");
-                printf("Invalid classes\n");
-            }
+    if ((n > NUM_CLASSES) || (tensor.numel() != n)) {
+        printf("\nPost-processed output:\n");
+        printf("Invalid classes\n");
+        return;
+    }
+
+    memset(class_probs, 0, sizeof(class_probs));
+
+    if (tensor.scalar_type() == ScalarType::Float) {
+        const float* logits = tensor.const_data_ptr<float>();
+
+        count = top_k(logits, n, top);
+        if (desc.softmax) {
+            softmax(logits, class_probs, n);
         } else {
-            printf("Output[%d]: Not Tensor\n", i);
+            memcpy(class_probs, logits, n * sizeof(float));
         }
+    } else if (tensor.scalar_type() == ScalarType::Char) {
+        const int8_t* logits = tensor.const_data_ptr<int8_t>();
+
+        if (!(desc.output_scale > 0.0f)) {
+            printf("Output[%d]: int8 logits, but no output quantization in the model descriptor\n",
+                   desc.output_index);
+            return;
+        }
+
+        count = top_k(logits, n, top);
+        int8_probs(logits, n, desc, class_probs);
+    } else {
+        printf("Output[%d]: Unsupported type\n", desc.output_index);
+        return;
+    }
+
+    const int predicted_idx = top[0];
+    const float confidence = class_probs[predicted_idx];
+    const char* name = desc.class_names[predicted_idx];
+    const bool unknown = (predicted_idx == desc.unknown_index);
+
+    /* Compact top-k record */
+    topk_result.model = static_cast<uint8_t>(model_config);
+    topk_result.count = static_cast<uint8_t>(count);
+    topk_result.flags = unknown ? RUNNER_TOPK_FLAG_UNKNOWN : 0U;
+    for (int i = 0; i < ML_TOPK; i++) {
+        float p = (i < count) ? class_probs[top[i]] : 0.0f;
+        p = (p < 0.0f) ? 0.0f : ((p > 1.0f) ? 1.0f : p);
+        topk_result.entry[i].index = (i < count) ? top[i] : 0U;
+        topk_result.entry[i].reserved = 0U;
+        topk_result.entry[i].score = static_cast<uint16_t>(p * 65535.0f + 0.5f);
     }
+
+    if (!unknown) {
+        // To reduce clutter, print predicted class and confidence only if predicted class is different then unknown
+        const char* color = get_log_color(predicted_idx);
+        LOG_MSG(LOG_PREDICTION, LOG_S(color), LOG_S(name), LOG_F(confidence * PERCENT_SCALE));
+    }
+
+    conf_score = confidence * PERCENT_SCALE;
+    conf_int = (int)conf_score;
+    strncpy(label_name, name, sizeof(label_name) - 1);
+    label_name[sizeof(label_name) - 1] = '\0';
+    strncpy(output_label.label_name, name, sizeof(output_label.label_name) - 1);
+    output_label.label_name[sizeof(output_label.label_name) - 1] = '\0';
+    output_label.confidence = conf_score;
+    classify_object = !unknown;
 }
 
 /**
- * \brief Full post-processing step: decode outputs, copy result, draw label.
+ * \brief Full post-processing step: decode outputs, copy result, update overlay.
  *
- * Combines print_outputs(), result copy into out_buf, and DrawClassLabelOnImage()
- * into a single call for use in ExecuteAlgorithm().
+ * Combines print_outputs(), result copy into out_buf, and the display overlay
+ * update into a single call for use in ExecuteAlgorithm(). The input frame is
+ * not modified; the label and confidence bars are drawn by display_overlay_draw().
  *
  * \param[in]     ctx      RunnerContext after a successful run_inference().
- * \param[in]     img_buf  RGB888 frame buffer to draw the label onto.
- * \param[out]    out_buf  Caller buffer to receive runner_output_label_t result.
+ * \param[out]    out_buf  Caller buffer to receive the class probabilities.
  * \param[in]     out_num  Byte size of out_buf.
  */
-void postprocess(RunnerContext& ctx, uint8_t* img_buf,
-                 uint8_t* out_buf, uint32_t out_num) {
+void postprocess(RunnerContext& ctx, uint8_t* out_buf, uint32_t out_num) {
     /* Decode output tensor → output_label, conf_int, classify_object */
     print_outputs(ctx);
 
     /* Copy classification result into caller's output buffer */
+#if ML_OUT_TOPK
+    if (out_num >= sizeof(topk_result)) {
+        memcpy(out_buf, &topk_result, sizeof(topk_result));
+    }
+#else
     if (out_num >= sizeof(class_probs)) {
         memcpy(out_buf, class_probs, sizeof(class_probs));
     }
+#endif
 
-    /* Format label string and draw onto frame */
+    /* Format label string and update the display overlay */
     snprintf(output_string, OUTPUT_STRING_SIZE, "%s-%d",
              output_label.label_name, conf_int);
     output_string[OUTPUT_STRING_SIZE - 1] = '\0';
 
-    DrawClassLabelOnImage(img_buf, IMAGE_WIDTH, IMAGE_HEIGHT, output_string);
+    display_overlay_set_result(output_string, class_probs,
+                               model_descs[model_config].class_names,
+                               model_descs[model_config].num_classes);
+}
+
+#if defined(ET_EVENT_TRACER_ENABLED)
+#if ML_ETDUMP_OUTPUT == 0
+/** \brief Base64 encoder state of the ETDump written to STDIO */
+typedef struct {
+    uint8_t group[3];
+    size_t  count;
+    char    line[64];
+    size_t  line_len;
+} etdump_base64_t;
+
+static const char base64_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * \brief Encode the collected bytes (1 to 3) of the base64 state
+ * \param[in,out] state  Base64 encoder state
+ */
+static void etdump_base64_encode(etdump_base64_t* state) {
+    const uint8_t* g = state->group;
+    char* out;
+
+    if (state->line_len > sizeof(state->line) - 4) {
+        fwrite(state->line, 1, state->line_len, stdout);
+        state->line_len = 0;
+    }
+    for (size_t i = state->count; i < sizeof(state->group); i++) {
+        state->group[i] = 0;
+    }
+
+    out = &state->line[state->line_len];
+    out[0] = base64_chars[g[0] >> 2];
+    out[1] = base64_chars[((g[0] & 0x03) << 4) | (g[1] >> 4)];
+    out[2] = (state->count > 1) ? base64_chars[((g[1] & 0x0F) << 2) | (g[2] >> 6)] : '=';
+    out[3] = (state->count > 2) ? base64_chars[g[2] & 0x3F] : '=';
+    state->line_len += 4;
+    state->count = 0;
+}
+
+/** \brief ArmEventTracer::WriteFn writing base64 to STDIO */
+static void etdump_write_base64(const uint8_t* data, size_t len, void* arg) {
+    etdump_base64_t* state = static_cast<etdump_base64_t*>(arg);
+
+    for (size_t i = 0; i < len; i++) {
+        state->group[state->count++] = data[i];
+        if (state->count == sizeof(state->group)) {
+            etdump_base64_encode(state);
+        }
+    }
+}
+#else
+/** \brief Size of the SDS records holding the ETDump */
+#define ETDUMP_SDS_BLOCK_SIZE    1024U
+
+/** \brief SDS writer state of the ETDump */
+typedef struct {
+    sdsRecPlayId_t id;
+    uint8_t        block[ETDUMP_SDS_BLOCK_SIZE];
+    size_t         len;
+    bool           error;
+} etdump_sds_t;
+
+/** \brief SDS recorder buffer of the ETDump stream */
+static uint8_t etdump_sds_buf[4U * ETDUMP_SDS_BLOCK_SIZE];
+
+/**
+ * \brief Write the collected bytes as one SDS record, waiting for buffer space
+ * \param[in,out] state  SDS writer state
+ */
+static void etdump_sds_flush(etdump_sds_t* state) {
+    int32_t retv = 0;
+
+    if ((state->len == 0) || state->error) {
+        state->len = 0;
+        return;
+    }
+    for (uint32_t retry = 0U; retry < 1000U; retry++) {
+        retv = sdsRecWrite(state->id, osKernelGetTickCount(), state->block,
+                           state->len);
+        if (retv == (int32_t)state->len) {
+            break;
+        }
+        osDelay(1U);
+    }
+    state->error = (retv != (int32_t)state->len);
+    state->len = 0;
 }
 
-void write_etdump(RunnerContext& ctx) {}
+/** \brief ArmEventTracer::WriteFn writing SDS records */
+static void etdump_write_sds(const uint8_t* data, size_t len, void* arg) {
+    etdump_sds_t* state = static_cast<etdump_sds_t*>(arg);
+
+    while (len > 0) {
+        size_t n = sizeof(state->block) - state->len;
+        if (n > len) {
+            n = len;
+        }
+        memcpy(&state->block[state->len], data, n);
+        state->len += n;
+        data += n;
+        len -= n;
+        if (state->len == sizeof(state->block)) {
+            etdump_sds_flush(state);
+        }
+    }
+}
+#endif
+#endif
+
+/**
+ * \brief Write the events recorded by the event tracer as ETDump
+ *
+ * The ETDump is serialised directly to STDIO (base64) or to the SDS stream
+ * "ETDump" (ML_ETDUMP_OUTPUT), then the recorded events are discarded.
+ *
+ * \param[in] ctx Runner context
+ */
+void write_etdump(RunnerContext& ctx) {
+    (void)ctx;
+#if defined(ET_EVENT_TRACER_ENABLED)
+    size_t size = 0;
+
+#if ML_ETDUMP_OUTPUT == 0
+    static etdump_base64_t state;
+
+    state.count = 0;
+    state.line_len = 0;
+    printf("#[RUN THIS]\necho \"");
+    size = event_tracer.write_etdump(etdump_write_base64, &state);
+    if (state.count != 0) {
+        etdump_base64_encode(&state);
+    }
+    fwrite(state.line, 1, state.line_len, stdout);
+    printf("\" | base64 -d >etdump.bin\n"
+           "python3 -m devtools.inspector.inspector_cli --etdump_path etdump.bin"
+           " --source_time_scale cycles --target_time_scale cycles\n"
+           "#[END]\n");
+#else
+    static etdump_sds_t state;
+
+    state.len = 0;
+    state.error = false;
+    state.id = sdsRecOpen("ETDump", etdump_sds_buf, sizeof(etdump_sds_buf));
+    if (state.id == NULL) {
+        printf("Failed to open SDS stream for recording of ETDump!\n");
+        return;
+    }
+    size = event_tracer.write_etdump(etdump_write_sds, &state);
+    etdump_sds_flush(&state);
+    if ((sdsRecClose(state.id) != SDS_REC_PLAY_OK) || state.error) {
+        printf("ERROR: Failed to record ETDump!\n");
+    }
+#endif
+
+    printf("ETDump: %u events, %u dropped, %u bytes\n",
+           (unsigned int)event_tracer.num_events(),
+           (unsigned int)event_tracer.dropped_events(), (unsigned int)size);
+    event_tracer.reset();
+#else
+    printf("ETDump not available, define ET_EVENT_TRACER_ENABLED\n");
+#endif
+}
 
 /**
  * \brief Verify model execution results
@@ -993,54 +1677,184 @@ bool verify_result(RunnerContext& ctx, const void* model_pte) {
 }
 
 /**
- * \brief Execute model inference on the pre-processed input tensor.
+ * \brief Load the method of a model again, into the memory it was loaded into
  *
- * Expects input_tensor_data[] to have already been filled by a prior call
- * to preprocess().  After this function returns
- * successfully, call print_outputs() to decode the results.
+ * A method whose step() failed stays at the failed instruction and can only
+ * be rewound after EndOfMethod, so it is replaced by a new instance. Loading
+ * is deterministic: the new instance takes exactly the memory of the old one
+ * and the pool does not grow.
  *
  * \param[in,out] ctx  Runner context
- * \return true if execution succeeded, false otherwise
  */
-bool run_inference(RunnerContext& ctx) {
+static void reload_method(RunnerContext& ctx) {
+    /* The old instance is destroyed before its memory is reused */
+    ctx.method.clear();
+    ctx.method_region.reset(static_cast<uint32_t>(ctx.method_memory_size),
+                            ctx.method_memory);
+    ctx.memory_manager.reset(&ctx.method_region.value(),
+                             &ctx.planned_memory.value(), ctx.temp_allocator);
+    ctx.method.reset(ctx.program->load_method(
+        ctx.method_name, &ctx.memory_manager.value(), method_event_tracer()));
+
+    Error status = ctx.method->error();
+    if (status == Error::Ok) {
+        status = bind_model_input(ctx);
+    }
+    ET_CHECK_MSG(status == Error::Ok,
+                 "Reloading of method %s failed with status 0x%" PRIx32,
+                 ctx.method_name, (uint32_t)status);
+}
+
+/**
+ * \brief Abandon an inference whose method failed part way through.
+ *
+ * Withdraws the async request or collects the NPU job without its outputs,
+ * which also ends the delegate events of the run, and reloads the method so
+ * that the next inference starts from its first instruction.
+ *
+ * \param[in,out] ctx  Runner context
+ */
+static void abort_inference(RunnerContext& ctx) {
+    EthosUBackend_cancel_async();
+    ctx.temp_allocator->reset();
+    reload_method(ctx);
+}
+
+/**
+ * \brief Start model inference on the pre-processed input tensor.
+ *
+ * Steps the method until the Ethos-U delegate has started the NPU job and
+ * returns, so the caller can do other work while the NPU runs. Expects the
+ * input to have already been filled by a prior call to preprocess(). Must be
+ * followed by run_inference_wait().
+ *
+ * \param[in,out] ctx  Runner context
+ * \return true if execution started, false otherwise
+ */
+bool run_inference_start(RunnerContext& ctx) {
     Error status = Error::Ok;
-    int n = 0;
-    for (n = 0; n < num_inferences; n++) {
+    Method& method = *ctx.method.value();
 
-        std::vector<std::pair<char*, size_t>> input_buffers;
-        input_buffers.emplace_back(reinterpret_cast<char*>(input_tensor_data),
-                                   sizeof(input_tensor_data));
+#if ENABLE_TIME_PROFILING
+    inference_time = profiler_start();
+#endif
+    timeline_begin(TIMELINE_QUANTIZE);
 
-        /* Update input tensors with pre-processed frame data */
-        status = update_input_tensors(
-            *ctx.method.value(), ctx.method_allocator.value(), input_buffers);
+    ctx.temp_allocator->reset();
+    npu_pmu_reset();
 
+#if defined(ET_EVENT_TRACER_ENABLED)
+    /* One ETDump run per inference, as Method::execute() would start */
+    event_tracer.create_event_block("Execute");
+#endif
+
+    /* Run CPU operators up to and including the start of the NPU job */
+    if (EthosUBackend_request_async() != 0) {
+        printf("Inference of method %s started while the NPU is busy\n",
+               ctx.method_name);
+        return false;
+    }
+    while (!EthosUBackend_async_pending()) {
+        status = method_step(method);
         if (status != Error::Ok) {
-            printf("Failed to update input tensors: 0x%x\n", status);
             break;
         }
+    }
 
-#if ENABLE_TIME_PROFILING
-        inference_time = profiler_start();
+    if ((status != Error::Ok) && (status != Error::EndOfMethod)) {
+        printf("Execution of method %s failed with status 0x%" PRIx32 "\n",
+               ctx.method_name, (uint32_t)status);
+        abort_inference(ctx);
+        return false;
+    }
+    timeline_end(TIMELINE_QUANTIZE);
+    timeline_begin(TIMELINE_NPU);
+    return true;
+}
+
+/**
+ * \brief Complete an inference started with run_inference_start().
+ *
+ * Waits for the NPU job, copies the delegate outputs back and runs the
+ * remaining CPU operators. A failed NPU job still runs the method to its
+ * end, so that it can be rewound for the next inference. After this
+ * function returns successfully, call postprocess() to decode the results.
+ *
+ * \param[in,out] ctx  Runner context
+ * \return true if execution succeeded, false otherwise
+ */
+bool run_inference_wait(RunnerContext& ctx) {
+    Error status = Error::Ok;
+    Method& method = *ctx.method.value();
+#if defined(ET_EVENT_TRACER_ENABLED)
+    const bool npu_pending = (EthosUBackend_async_pending() != 0);
 #endif
 
-        status = ctx.method.value()->execute();
-        if (status != Error::Ok) {
-            break;
-        }
-        ctx.temp_allocator.reset(temp_allocation_pool_size,
-                                 temp_allocation_pool);
+    const bool npu_ok = (EthosUBackend_wait() == 0);
+    timeline_end(TIMELINE_NPU);
+
+#if defined(ET_EVENT_TRACER_ENABLED)
+    if (npu_pending) {
+        /* The delegate call and its step returned at the job launch, end them with the job */
+        event_tracer.extend_event("DELEGATE_CALL");
+        event_tracer.extend_event("Method::step");
+    }
+#endif
+    timeline_begin(TIMELINE_DEQUANTIZE);
+
+    while (status == Error::Ok) {
+        status = method_step(method);
+    }
+    if (status == Error::EndOfMethod) {
+        status = method_reset_execution(method);
+    }
+    timeline_end(TIMELINE_DEQUANTIZE);
+
+    ctx.temp_allocator->reset();
+
+#if defined(ET_EVENT_TRACER_ENABLED) && NPU_PMU_ENABLE
+    /* PMU counters of each NPU job as metadata of its delegate event */
+    for (uint32_t i = 0; i < npu_pmu_num_samples(); i++) {
+        event_tracer.set_event_metadata("EthosUBackend::execute()", i,
+                                        npu_pmu_get_sample(i),
+                                        sizeof(npu_pmu_sample_t));
+    }
+#endif
 
 #if ENABLE_TIME_PROFILING
-        inference_time = profiler_stop(inference_time);
-        printf("Inference time: %3.3f ms.\n",
-               profiler_cycles_to_ms(inference_time, CPU_FREQ_HZ));
+    inference_time = profiler_stop(inference_time);
+    LOG_MSG(LOG_INFERENCE_TIME, LOG_U(inference_time));
+    latency_hist_add(LATENCY_INFERENCE, inference_time);
 #endif
+
+    if (status != Error::Ok) {
+        printf("Execution of method %s failed with status 0x%" PRIx32 "\n",
+               ctx.method_name, (uint32_t)status);
+        abort_inference(ctx);
+    } else if (!npu_ok) {
+        printf("NPU job of method %s failed\n", ctx.method_name);
     }
+    return (status == Error::Ok) && npu_ok;
+}
 
-    ET_CHECK_MSG(status == Error::Ok,
-                 "Execution of method %s failed with status 0x%" PRIx32,
-                 ctx.method_name, status);
+/**
+ * \brief Execute model inference on the pre-processed input tensor.
+ *
+ * Expects the input to have already been filled by a prior call to
+ * preprocess().  After this function returns
+ * successfully, call print_outputs() to decode the results.
+ *
+ * \param[in,out] ctx  Runner context
+ * \return true if execution succeeded, false otherwise
+ */
+bool run_inference(RunnerContext& ctx) {
+    bool ok = true;
+    int n = 0;
+    for (n = 0; (n < num_inferences) && ok; n++) {
+        ok = run_inference_start(ctx) && run_inference_wait(ctx);
+    }
+
+    ET_CHECK_MSG(ok, "Execution of method %s failed", ctx.method_name);
 
-    return (status == Error::Ok);
-}
\ No newline at end of file
+    return ok;
+}
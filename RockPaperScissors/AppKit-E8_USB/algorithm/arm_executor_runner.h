@@ -9,12 +9,12 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
-#include <vector>
-#include <utility>
 
 #include <executorch/extension/data_loader/buffer_data_loader.h>
 #include <executorch/runtime/executor/program.h>
 
+#include "config_ml_model.h"
+
 /* ============================================================================
  * Constants
  * ============================================================================
@@ -26,6 +26,12 @@
 #define MAX_LABEL_NAME_LENGTH        100
 #define OUTPUT_STRING_SIZE           100
 
+/* Model configurations, select the class names and post-processing */
+#define VEHICLE_MODEL                0
+#define BANANA_RIPENESS_MODEL        1
+#define TOOL_MODEL                   2
+#define RPS_MODEL                    3
+
 /* ============================================================================
  * Classification Result
  * ============================================================================
@@ -40,6 +46,30 @@ typedef struct {
     float confidence;                        /**< Confidence score */
 } runner_output_label_t;
 
+/** \brief Top-k record flag: the most probable class is the unknown class */
+#define RUNNER_TOPK_FLAG_UNKNOWN     0x0001U
+
+/**
+ * \brief One class of a top-k record.
+ */
+typedef struct {
+    uint8_t  index;                          /**< Class index */
+    uint8_t  reserved;                       /**< Reserved, 0 */
+    uint16_t score;                          /**< Probability, 0 .. 65535 for 0.0 .. 1.0 */
+} runner_topk_entry_t;
+
+/**
+ * \brief Compact classification result: the ML_TOPK most probable classes.
+ *        Populated by print_outputs(); copied into out_buf with ML_OUT_TOPK.
+ *        Entries beyond count are zero.
+ */
+typedef struct {
+    uint8_t             model;               /**< Model configuration (e.g. RPS_MODEL) */
+    uint8_t             count;               /**< Number of valid entries */
+    uint16_t            flags;               /**< RUNNER_TOPK_FLAG_... */
+    runner_topk_entry_t entry[ML_TOPK];      /**< Most probable class first */
+} runner_topk_t;
+
 /* ============================================================================
  * Forward Declaration of RunnerContext
  * ============================================================================
@@ -47,7 +77,18 @@ typedef struct {
 struct RunnerContext;
 
 /**
- * \brief Get a process-lifetime RunnerContext owned by arm_executor_runner.cc.
+ * \brief Model to be loaded by runner_init_models().
+ */
+typedef struct {
+    executorch::runtime::Program *program;  /**< Already-loaded Program instance */
+    const void                   *pte;      /**< Model PTE blob, read for the input quantization */
+    size_t                        pte_size; /**< Byte size of the model PTE blob */
+    int                           config;   /**< Model configuration (e.g. RPS_MODEL) */
+} runner_model_t;
+
+/**
+ * \brief Get the process-lifetime RunnerContext of the active model, owned by
+ *        arm_executor_runner.cc.
  *        Use this when only an opaque pointer is needed in other translation units.
  *
  * \return Pointer to an internal static RunnerContext.
@@ -60,22 +101,48 @@ RunnerContext* runner_context_instance(void);
  */
 
 /**
- * \brief Initialise a RunnerContext and load the model method.
+ * \brief Load the model method of each program into its own RunnerContext.
  *        Call once inside InitAlgorithm(), before the first run_inference().
+ *        All memory used by inference is set up here; the per-frame
+ *        functions below do not allocate memory.
+ *        All models share one method allocator pool, one planned-memory
+ *        arena and, with ET_ARM_ETHOSU_ZERO_COPY_IO, one Ethos-U scratch
+ *        arena, each sized for the largest model, since only one model runs
+ *        at a time. The first model is made active.
  *
- * \param[in,out] ctx           RunnerContext to initialise.
- * \param[in]     input_buffers Pass an empty vector on init.
- * \param[in]     pte_size      Byte size of the model PTE blob.
- * \param[in]     program       Pointer to an already-loaded Program instance.
+ * \param[in] models      Models to load.
+ * \param[in] num_models  Number of models (1 .. ML_MAX_MODELS).
+ * \return Number of loaded models.
  */
-void runner_init(RunnerContext                              &ctx,
-                 std::vector<std::pair<char *, size_t>>     input_buffers,
-                 size_t                                     pte_size,
-                 executorch::runtime::Program              *program);
+size_t runner_init_models(const runner_model_t *models, size_t num_models);
 
 /**
- * \brief Convert one RGB888 HWC frame into the model's float input tensor.
- *        Transposes HWC→CHW and applies ImageNet normalisation.
+ * \brief Get the number of models loaded by runner_init_models().
+ *
+ * \return Number of loaded models.
+ */
+size_t runner_model_count(void);
+
+/**
+ * \brief Make a loaded model the active one, without reloading it.
+ *        Pre- and post-processing follow the active model. Call only
+ *        between inferences, never between run_inference_start() and
+ *        run_inference_wait(). The planned memory of the previous model is
+ *        overwritten by the next inference, so its outputs must have been
+ *        post-processed.
+ *
+ * \param[in] index  Model index, in the order passed to runner_init_models().
+ * \return RunnerContext of the model, or nullptr if index is out of range.
+ */
+RunnerContext* runner_select_model(size_t index);
+
+/**
+ * \brief Convert one RGB888 HWC frame into the model's input tensor.
+ *        Transposes HWC→CHW and applies ImageNet normalisation. With
+ *        ML_INPUT_FUSED_QUANT the int8 input of the delegate is written
+ *        directly through a per-channel lookup table. Otherwise the float
+ *        input is written in place, into the memory planned input or into
+ *        the application buffer bound to an unplanned input.
  *        Must be called before run_inference() each frame.
  *
  * \param[in] image  RGB888 HWC source image (224 x 224 x 3 bytes).
@@ -91,14 +158,47 @@ void preprocess(const uint8_t *image);
 bool run_inference(RunnerContext &ctx);
 
 /**
- * \brief Full post-processing: decode outputs, copy result, draw label on frame.
+ * \brief Start one inference cycle and return once the NPU job is running.
+ *        The caller may do unrelated CPU work, then must call
+ *        run_inference_wait() before touching the model input or output.
+ *
+ * \param[in,out] ctx  Initialised RunnerContext (from runner_init()).
+ * \return true on success, false on failure.
+ */
+bool run_inference_start(RunnerContext &ctx);
+
+/**
+ * \brief Wait for the inference started by run_inference_start() to finish.
+ *
+ * \param[in,out] ctx  Initialised RunnerContext (from runner_init()).
+ * \return true on success, false on failure.
+ */
+bool run_inference_wait(RunnerContext &ctx);
+
+/**
+ * \brief Full post-processing: decode outputs, copy result, update the
+ *        display overlay (label and confidence bars).
+ *        Decoding follows the descriptor of the active model (class names,
+ *        output index, softmax, unknown class) and works on float as well
+ *        as int8 model outputs.
  *
  * \param[in]     ctx      RunnerContext after a successful run_inference().
- * \param[in]     img_buf  RGB888 frame buffer to draw the label onto.
- * \param[out]    out_buf  Caller buffer to receive runner_output_label_t result.
+ * \param[out]    out_buf  Caller buffer to receive the class probabilities,
+ *                         or the runner_topk_t record with ML_OUT_TOPK.
  * \param[in]     out_num  Byte size of out_buf.
  */
-void postprocess(RunnerContext &ctx, uint8_t *img_buf,
-                 uint8_t *out_buf, uint32_t out_num);
+void postprocess(RunnerContext &ctx, uint8_t *out_buf, uint32_t out_num);
+
+/**
+ * \brief Write the profiling events recorded since the last call as ETDump
+ *        (ET_EVENT_TRACER_ENABLED) and discard them.
+ *        Operator, delegate and Ethos-U backend events of all models are
+ *        recorded into a static buffer (ML_ETDUMP_BUF_SIZE), one run per
+ *        inference, and written to STDIO or an SDS stream (ML_ETDUMP_OUTPUT).
+ *        Call between inferences.
+ *
+ * \param[in] ctx  RunnerContext of the active model.
+ */
+void write_etdump(RunnerContext &ctx);
 
 #endif /* ARM_EXECUTOR_RUNNER_H */
\ No newline at end of file
@@ -7,7 +7,7 @@
 #include "arm_memory_allocator.h"
 
 ArmMemoryAllocator::ArmMemoryAllocator(uint32_t size, uint8_t* base_address)
-    : MemoryAllocator(size, base_address), used_(0) {}
+    : MemoryAllocator(size, base_address), used_(0), peak_used_(0) {}
 
 void* ArmMemoryAllocator::allocate(size_t size, size_t alignment) {
   void* ret = executorch::runtime::MemoryAllocator::allocate(size, alignment);
@@ -22,6 +22,9 @@ void* ArmMemoryAllocator::allocate(size_t size, size_t alignment) {
     } else {
       used_ = (used_ | (alignment - 1)) + 1 + size;
     }
+    if (used_ > peak_used_) {
+      peak_used_ = used_;
+    }
   }
   return ret;
 }
@@ -34,6 +37,10 @@ size_t ArmMemoryAllocator::free_size() const {
   return executorch::runtime::MemoryAllocator::size() - used_;
 }
 
+size_t ArmMemoryAllocator::peak_used_size() const {
+  return peak_used_;
+}
+
 void ArmMemoryAllocator::reset() {
   executorch::runtime::MemoryAllocator::reset();
   used_ = 0;
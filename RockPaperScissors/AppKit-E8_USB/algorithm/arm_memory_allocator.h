@@ -23,8 +23,12 @@ class ArmMemoryAllocator : public executorch::runtime::MemoryAllocator {
 
   // Returns the free size of the allocator's memory buffer.
   size_t free_size() const;
+
+  // Returns the largest used size since construction, kept across reset().
+  size_t peak_used_size() const;
   void reset() override;
 
  private:
   size_t used_;
+  size_t peak_used_;
 };
@@ -100,6 +100,26 @@
 #error "RGB image must be smaller than camera frame, check RGB_IMAGE_WIDTH and RGB_IMAGE_HEIGHT definitions."
 #endif
 
+/* Camera frame region resized to the ML image (centred) */
+#if (CAMERA_CROP_WIDTH == 0) || (CAMERA_CROP_HEIGHT == 0)
+#if (CAMERA_FRAME_WIDTH < CAMERA_FRAME_HEIGHT)
+#define ML_CROP_WIDTH          CAMERA_FRAME_WIDTH
+#define ML_CROP_HEIGHT         CAMERA_FRAME_WIDTH
+#else
+#define ML_CROP_WIDTH          CAMERA_FRAME_HEIGHT
+#define ML_CROP_HEIGHT         CAMERA_FRAME_HEIGHT
+#endif
+#else
+#define ML_CROP_WIDTH          CAMERA_CROP_WIDTH
+#define ML_CROP_HEIGHT         CAMERA_CROP_HEIGHT
+#endif
+#define ML_CROP_X              ((CAMERA_FRAME_WIDTH  - ML_CROP_WIDTH)  / 2)
+#define ML_CROP_Y              ((CAMERA_FRAME_HEIGHT - ML_CROP_HEIGHT) / 2)
+
+#if (ML_CROP_WIDTH > CAMERA_FRAME_WIDTH) || (ML_CROP_HEIGHT > CAMERA_FRAME_HEIGHT)
+#error "Model input crop must fit into camera frame, check CAMERA_CROP_WIDTH and CAMERA_CROP_HEIGHT definitions."
+#endif
+
 /* Number of bytes per pixel for RGB buffer (RGB888) */
 #define RGB_IMAGE_COLOR_BYTES       3
 
@@ -43,5 +43,95 @@
 #ifndef ML_IMAGE_BUF_ALIGNMENT
 #define ML_IMAGE_BUF_ALIGNMENT      4
 #endif
+// ML Fused Input Quantization
+// Enable writing the model's int8 input directly from the RGB888 image.
+// ImageNet normalisation and input quantization are folded into a per-channel
+// lookup table built from the scale and zero point that the program passes to
+// the quantize_per_tensor of the model input. That call is skipped, so the
+// float input tensor and the CPU quantize pass are not used. Set to 0 to feed
+// the float input tensor instead.
+// Default: 1
+#ifndef ML_INPUT_FUSED_QUANT
+#define ML_INPUT_FUSED_QUANT        1
+#endif
+// ML Maximum Models
+// Maximum number of models loaded at initialization. All models share the
+// method allocator pool, one planned-memory arena and one Ethos-U scratch
+// arena, each sized for the largest model, so the active model can be
+// switched at run-time without reloading.
+// Default: 1
+#ifndef ML_MAX_MODELS
+#define ML_MAX_MODELS               1
+#endif
+// ML Top-k Classes
+// Number of most probable classes kept in the compact top-k result record.
+// Default: 3
+#ifndef ML_TOPK
+#define ML_TOPK                     3
+#endif
+// ML Output Top-k Record
+// Select the algorithm output data (ML_Out stream):
+//  0: class probabilities, one float per class (ML_Out.sds.yml)
+//  1: compact top-k result record (ML_Out_TopK.sds.yml)
+// Default: 0
+#ifndef ML_OUT_TOPK
+#define ML_OUT_TOPK                 0
+#endif
+
+// ML Motion Gate
+// Enable skipping inference for frames of an unchanged scene. The luma of
+// each frame is compared with the last inferred frame, and when the scene
+// did not change the previous result is reused and the NPU is not started.
+// Default: 0
+#ifndef ML_MOTION_GATE
+#define ML_MOTION_GATE              0
+#endif
+// ML Motion Gate Threshold
+// Define the mean luma difference (0..255) above which a cell of the ML
+// image (MOTION_GATE_CELL_SIZE square, motion_gate.h) counts as changed.
+// Default: 8
+#ifndef ML_MOTION_GATE_THRESHOLD
+#define ML_MOTION_GATE_THRESHOLD    8
+#endif
+// ML Motion Gate Changed Cells
+// Define the number of changed cells tolerated in a frame of an unchanged scene.
+// Default: 2
+#ifndef ML_MOTION_GATE_MAX_CHANGED
+#define ML_MOTION_GATE_MAX_CHANGED  2
+#endif
+// ML Motion Gate Maximum Reuse
+// Define the maximum number of consecutive frames reusing the previous
+// result, after which the next frame is passed on to inference.
+// Default: 30
+#ifndef ML_MOTION_GATE_MAX_REUSE
+#define ML_MOTION_GATE_MAX_REUSE    30
+#endif
+
+// ML ETDump Buffer Size
+// Define the size in bytes of the buffer holding the profiling events of the
+// ExecuTorch event tracer (40 bytes per event, plus the delegate metadata
+// such as the NPU PMU counters of npu_pmu.h). Used when
+// ET_EVENT_TRACER_ENABLED is defined for all ExecuTorch sources
+// (ai_layer.clayer.yml); events beyond the buffer size are dropped.
+// Default: 32768
+#ifndef ML_ETDUMP_BUF_SIZE
+#define ML_ETDUMP_BUF_SIZE          32768
+#endif
+
+// ML ETDump Buffer Section Name
+// Define the name of the section for the event tracer buffer
+// Default: ".bss.etdump_buf"
+#ifndef ML_ETDUMP_BUF_SECTION
+#define ML_ETDUMP_BUF_SECTION       ".bss.etdump_buf"
+#endif
+
+// ML ETDump Output
+// Select where the ETDump is written on request ('e' over STDIO):
+//  0: STDIO, base64 encoded between "#[RUN THIS]" and "#[END]" lines
+//  1: SDS stream "ETDump" (ETDump.<n>.sds, data of all records in sequence)
+// Default: 0
+#ifndef ML_ETDUMP_OUTPUT
+#define ML_ETDUMP_OUTPUT            0
+#endif
 
 #endif /* CONFIG_ML_MODEL_H__ */
\ No newline at end of file
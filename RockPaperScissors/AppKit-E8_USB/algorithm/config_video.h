@@ -68,6 +68,46 @@
 #define CAMERA_FRAME_BUF_ALIGNMENT  32
 #endif
 
+//  <o>Frame Buffer Blocks <1-8>
+//  <i> Define the number of camera frames in the capture ring buffer.
+//  <i> 1: a single frame is captured on each request.
+//  <i> 3 or more: frames are captured continuously, the newest completed
+//  <i> frame is used and older frames are dropped.
+//  <i> Each block takes one camera frame of SRAM0, which also holds the
+//  <i> display frame buffers: at 1280x720 RGB565 a frame is 1.76 MiB, so
+//  <i> 3 blocks need a smaller camera frame to fit the 4 MiB of SRAM0.
+//  <i> Default: 1
+#ifndef CAMERA_FRAME_BLOCKS
+#define CAMERA_FRAME_BLOCKS         1
+#endif
+
+//  <o>Model Input Crop Width
+//  <i> Define the width of the centred camera frame region that is
+//  <i> resized to the ML model input.
+//  <i> 0: largest centred square of the camera frame.
+//  <i> Default: 0
+#ifndef CAMERA_CROP_WIDTH
+#define CAMERA_CROP_WIDTH           0
+#endif
+
+//  <o>Model Input Crop Height
+//  <i> Define the height of the centred camera frame region that is
+//  <i> resized to the ML model input.
+//  <i> 0: largest centred square of the camera frame.
+//  <i> Default: 0
+#ifndef CAMERA_CROP_HEIGHT
+#define CAMERA_CROP_HEIGHT          0
+#endif
+
+//  <o>Model Input Resize Mode <0=>Nearest <1=>Bilinear <2=>Area
+//  <i> Define how the cropped RGB565 or RGB888 camera frame is resampled
+//  <i> to the ML model input. Area averages all covered camera pixels and
+//  <i> suits large downscales. RAW8 frames are always debayered while sampling.
+//  <i> Default: 1
+#ifndef CAMERA_RESIZE_MODE
+#define CAMERA_RESIZE_MODE          1
+#endif
+
 //  <o>RGB Image Width
 //  <i> Define the RGB image width.
 //  <i> Default: 384
@@ -131,6 +171,20 @@
 #define DISPLAY_FRAME_BUF_ALIGNMENT 32
 #endif
 
+//  <o>Frame Buffer Blocks <1-4>
+//  <i> Define the number of display frame buffers.
+//  <i> 1: a single frame buffer is drawn once the display has shown
+//  <i> the previous frame.
+//  <i> 2 or more: frames are drawn into a free buffer and flipped to the
+//  <i> display on the next vertical sync.
+//  <i> Each block takes one display frame of SRAM0 (1.10 MiB at 480x800
+//  <i> RGB888); with a 1280x720 RGB565 camera frame, a second block
+//  <i> leaves less than 50 KiB of the 4 MiB SRAM0 for the other data.
+//  <i> Default: 1
+#ifndef DISPLAY_FRAME_BLOCKS
+#define DISPLAY_FRAME_BLOCKS        1
+#endif
+
 //  <o>Display Flip Horizontal <0=>Disable <1=>Enable
 //  <i> Enable to mirror display content left-right.
 //  <i> Default: 1
@@ -0,0 +1,149 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  CPU load accounting.
+
+  RTX calls EvrRtxThreadSwitched() from the kernel whenever another thread
+  is switched in (RTX event generation for threads, OS_EVR_THREAD, must not
+  be disabled). The hook adds the DWT cycles since the previous switch to
+  the thread switched out. Each thread has a slot, found by its thread id,
+  whose cycle counter is only written by the hook; cpu_load_update() takes
+  the difference to its previous read and sums the slots up per thread
+  group, which is matched by thread name.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "cpu_load.h"
+#include "profiler.h"
+
+#if CPU_LOAD_ENABLE
+
+static const char *const cpu_load_group_names[CPU_LOAD_NUM_GROUPS] = {
+  "Algorithm",
+  "Capture",
+  "sdsControl",
+  "StdinPoll",
+  "Log",
+  "USB",
+  "Other",
+  "Idle"
+};
+
+/* Slot of the threads not fitting into CPU_LOAD_MAX_THREADS, and of the time before the first switch */
+#define CPU_LOAD_SLOT_OTHER     CPU_LOAD_MAX_THREADS
+
+static osThreadId_t      cpu_load_thread[CPU_LOAD_MAX_THREADS];      /* Thread id per slot */
+static volatile uint32_t cpu_load_cycles[CPU_LOAD_MAX_THREADS + 1U]; /* Cycles per slot, written by the hook */
+static uint32_t          cpu_load_prev[CPU_LOAD_MAX_THREADS + 1U];   /* Cycles per slot at the previous update */
+static uint32_t          cpu_load_slot  = CPU_LOAD_SLOT_OTHER;       /* Slot of the running thread */
+static uint32_t          cpu_load_stamp;                             /* Cycle counter at the last switch */
+
+/* RTX thread switch event (rtx_evr.h), called in handler mode with the thread switched in */
+extern void EvrRtxThreadSwitched (osThreadId_t thread_id);
+
+void EvrRtxThreadSwitched (osThreadId_t thread_id) {
+  uint32_t now = profiler_start();
+  uint32_t slot;
+
+  cpu_load_cycles[cpu_load_slot] += now - cpu_load_stamp;
+  cpu_load_stamp = now;
+
+  for (slot = 0U; slot < CPU_LOAD_MAX_THREADS; slot++) {
+    if (cpu_load_thread[slot] == thread_id) {
+      break;
+    }
+    if (cpu_load_thread[slot] == NULL) {
+      cpu_load_thread[slot] = thread_id;
+      break;
+    }
+  }
+  cpu_load_slot = slot;
+}
+
+/* Thread group of a thread */
+static cpu_load_group_t cpu_load_group (osThreadId_t thread_id) {
+  const char *name = osThreadGetName(thread_id);
+  uint32_t group;
+
+  if (name == NULL) {
+    return CPU_LOAD_OTHER;
+  }
+  if (strncmp(name, "USB", 3U) == 0) {
+    return CPU_LOAD_USB;
+  }
+  for (group = 0U; group < CPU_LOAD_NUM_GROUPS; group++) {
+    if ((group != CPU_LOAD_USB) && (strcmp(name, cpu_load_group_names[group]) == 0)) {
+      return (cpu_load_group_t)group;
+    }
+  }
+  return CPU_LOAD_OTHER;
+}
+
+uint32_t cpu_load_update (cpu_load_t *load) {
+  uint32_t slot, cycles;
+  cpu_load_group_t group;
+
+  memset(load, 0, sizeof(cpu_load_t));
+
+  for (slot = 0U; slot <= CPU_LOAD_MAX_THREADS; slot++) {
+    cycles = cpu_load_cycles[slot];
+    if (cycles == cpu_load_prev[slot]) {
+      continue;
+    }
+    group = CPU_LOAD_OTHER;
+    if (slot < CPU_LOAD_MAX_THREADS) {
+      group = cpu_load_group(cpu_load_thread[slot]);
+    }
+    load->group[group] += cycles - cpu_load_prev[slot];
+    load->cycles       += cycles - cpu_load_prev[slot];
+    cpu_load_prev[slot] = cycles;
+  }
+
+  return load->cycles;
+}
+
+void cpu_load_print (const cpu_load_t *load) {
+  uint32_t group, permille;
+
+  if (load->cycles == 0U) {
+    return;
+  }
+  printf("CPU load:");
+  for (group = 0U; group < CPU_LOAD_NUM_GROUPS; group++) {
+    permille = (uint32_t)((((uint64_t)load->group[group] * 1000U) + (load->cycles / 2U)) / load->cycles);
+    printf(" %s %u.%u%%", cpu_load_group_names[group], (unsigned int)(permille / 10U), (unsigned int)(permille % 10U));
+  }
+  printf("\n");
+}
+
+#else
+
+uint32_t cpu_load_update (cpu_load_t *load) {
+  memset(load, 0, sizeof(cpu_load_t));
+  return 0U;
+}
+
+void cpu_load_print (const cpu_load_t *load) {
+  (void)load;
+}
+
+#endif
@@ -0,0 +1,84 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef CPU_LOAD_H__
+#define CPU_LOAD_H__
+
+#include <stdint.h>
+
+/* Account the CPU cycles of each thread at the RTX thread switches (0: disabled) */
+#ifndef CPU_LOAD_ENABLE
+#define CPU_LOAD_ENABLE         1
+#endif
+
+/* Record the CPU load of each reporting interval to the SDS stream "CPU_Load" (CPU_Load.sds.yml) */
+#ifndef CPU_LOAD_SDS
+#define CPU_LOAD_SDS            0
+#endif
+
+/* Number of threads accounted separately, cycles of further threads count as "Other" */
+#ifndef CPU_LOAD_MAX_THREADS
+#define CPU_LOAD_MAX_THREADS    16U
+#endif
+
+/* Thread groups the CPU cycles are reported for */
+typedef enum {
+  CPU_LOAD_ALGORITHM = 0,               /* "Algorithm" thread */
+  CPU_LOAD_CAPTURE,                     /* "Capture" thread (SDS_ALGO_FRAME_SLOTS > 1) */
+  CPU_LOAD_CONTROL,                     /* "sdsControl" thread */
+  CPU_LOAD_STDIN,                       /* "StdinPoll" thread */
+  CPU_LOAD_LOG,                         /* "Log" thread */
+  CPU_LOAD_USB,                         /* USB Device threads ("USB..") */
+  CPU_LOAD_OTHER,                       /* Timer, SDS I/O and all other threads */
+  CPU_LOAD_IDLE,                        /* "Idle" thread, the remaining headroom */
+  CPU_LOAD_NUM_GROUPS
+} cpu_load_group_t;
+
+/* CPU cycles of one reporting interval */
+typedef struct {
+  uint32_t cycles;                      /* CPU cycles of the interval */
+  uint32_t group[CPU_LOAD_NUM_GROUPS];  /* CPU cycles per thread group, CPU_LOAD_ALGORITHM onwards */
+} cpu_load_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the CPU cycles of each thread group since the previous call.
+ *
+ * Cycles spent in interrupt handlers count for the interrupted thread.
+ * Call from one thread only, at least every 10 s (32-bit cycle counter at 400 MHz).
+ *
+ * @param[out] load  CPU cycles of the interval.
+ * @return CPU cycles of the interval, 0 if no thread switch was accounted.
+ */
+uint32_t cpu_load_update(cpu_load_t *load);
+
+/**
+ * @brief Print the CPU load of each thread group in percent of the interval.
+ *
+ * @param[in] load  CPU cycles of the interval, from cpu_load_update().
+ */
+void cpu_load_print(const cpu_load_t *load);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_LOAD_H__ */
@@ -0,0 +1,253 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Classification result overlay.
+
+  The label, the confidence bars and a few lines of statistics are rendered
+  into a small overlay image that is kept across frames and composited into
+  each display frame, instead of being drawn into the ML image. The ML image
+  is displayed unmodified and each overlay area is only redrawn when its
+  content changes.
+
+  The revision of each area is recorded per display frame buffer, so only
+  the areas changed since the overlay was last composited into a frame
+  buffer are copied (dirty rectangles), also with multiple frame buffers.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "display_overlay.h"
+#include "image_processing_func.h"
+#include "text_render.h"
+
+/* Layout */
+#define OVERLAY_PADDING     4                       /* Border and line spacing            */
+#define LABEL_SCALE         2                       /* Label font scale                   */
+#define LABEL_MAX_LENGTH    (DISPLAY_OVERLAY_WIDTH / (TEXT_FONT_WIDTH * LABEL_SCALE))
+#define BAR_ROW_HEIGHT      (TEXT_FONT_HEIGHT + OVERLAY_PADDING)
+#define BAR_NAME_LENGTH     8                       /* Class name characters left of a bar */
+#define BAR_X               (OVERLAY_PADDING + (BAR_NAME_LENGTH * TEXT_FONT_WIDTH) + OVERLAY_PADDING)
+#define BAR_MAX_WIDTH       (DISPLAY_OVERLAY_WIDTH - BAR_X - OVERLAY_PADDING)
+#define BARS_Y              (OVERLAY_PADDING + (TEXT_FONT_HEIGHT * LABEL_SCALE) + OVERLAY_PADDING)
+#define STATS_Y             (BARS_Y + (DISPLAY_OVERLAY_MAX_BARS * BAR_ROW_HEIGHT))
+
+/* Overlay areas, redrawn and composited independently */
+#define AREA_RESULT         0                       /* Label and confidence bars          */
+#define AREA_STATS          1                       /* Statistics text                    */
+#define AREA_COUNT          2
+
+#if (STATS_Y >= DISPLAY_OVERLAY_HEIGHT)
+#error "Overlay too small for label and confidence bars, check DISPLAY_OVERLAY_HEIGHT definition."
+#endif
+
+/* Colours (RGB) */
+static const uint8_t color_background[3] = {  32,  32,  32 };
+static const uint8_t color_text[3]       = { 255, 255, 255 };
+static const uint8_t color_bar_track[3]  = {  64,  64,  64 };
+static const uint8_t color_bar[3]        = { 128, 128, 128 };
+static const uint8_t color_bar_top[3]    = {   0, 200,   0 };
+static const uint8_t color_stats[3]      = { 255, 200,   0 };
+
+/* Glyph atlases of the label and of the class names and statistics */
+static text_font_t font_label;
+static text_font_t font_small;
+
+/* Overlay image (RGB888) */
+static uint8_t overlay[DISPLAY_OVERLAY_WIDTH * DISPLAY_OVERLAY_HEIGHT * 3];
+
+/* Content currently rendered into the overlay */
+static char overlay_label[LABEL_MAX_LENGTH + 1];
+static int  overlay_bar[DISPLAY_OVERLAY_MAX_BARS];
+static int  overlay_bars;
+static int  overlay_top;
+static char overlay_stats[DISPLAY_OVERLAY_STATS_SIZE];
+
+/* First row of each overlay area, and the overlay height */
+static const int area_y[AREA_COUNT + 1] = { 0, STATS_Y, DISPLAY_OVERLAY_HEIGHT };
+
+/* Revision of each overlay area, incremented on each redraw */
+static uint32_t area_revision[AREA_COUNT];
+
+/* Area revisions composited into a display frame buffer (0: none) */
+typedef struct {
+  const uint8_t *frame;
+  int            x_offset;
+  int            y_offset;
+  uint32_t       revision[AREA_COUNT];
+} overlay_frame_t;
+
+static overlay_frame_t overlay_frames[DISPLAY_OVERLAY_MAX_FRAMES];
+static uint32_t        overlay_frame_next;
+
+/* Fill a rectangle of the overlay, clipped to the overlay */
+static void fill_rect(int x, int y, int w, int h, const uint8_t color[3]) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > DISPLAY_OVERLAY_WIDTH)  { w = DISPLAY_OVERLAY_WIDTH  - x; }
+  if (y + h > DISPLAY_OVERLAY_HEIGHT) { h = DISPLAY_OVERLAY_HEIGHT - y; }
+
+  for (int row = y; row < y + h; ++row) {
+    uint8_t *px = &overlay[(row * DISPLAY_OVERLAY_WIDTH + x) * 3];
+    for (int col = 0; col < w; ++col, px += 3) {
+      px[0] = color[0];
+      px[1] = color[1];
+      px[2] = color[2];
+    }
+  }
+}
+
+void display_overlay_init(void) {
+  text_font_init(&font_label, LABEL_SCALE);
+  text_font_init(&font_small, 1);
+
+  fill_rect(0, 0, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT, color_background);
+  overlay_label[0] = '\0';
+  overlay_bars     = 0;
+  overlay_top      = -1;
+  overlay_stats[0] = '\0';
+
+  memset(overlay_frames, 0, sizeof(overlay_frames));
+  overlay_frame_next = 0U;
+  for (int i = 0; i < AREA_COUNT; ++i) {
+    area_revision[i] = 1U;
+  }
+}
+
+void display_overlay_set_result(const char *label,
+                                const float *probs,
+                                const char *const *names,
+                                int num) {
+  const text_rect_t area = { 0, 0, DISPLAY_OVERLAY_WIDTH, STATS_Y };
+  int bar[DISPLAY_OVERLAY_MAX_BARS];
+  int top = 0;
+  int width;
+
+  if (num > DISPLAY_OVERLAY_MAX_BARS) {
+    num = DISPLAY_OVERLAY_MAX_BARS;
+  }
+
+  /* Bar lengths in pixels and the most probable class */
+  for (int i = 0; i < num; ++i) {
+    float p = probs[i];
+
+    if (p < 0.0f) {
+      p = 0.0f;
+    }
+    if (p > 1.0f) {
+      p = 1.0f;
+    }
+    bar[i] = (int)(p * (float)BAR_MAX_WIDTH + 0.5f);
+    if (probs[i] > probs[top]) {
+      top = i;
+    }
+  }
+
+  /* Nothing to redraw when the content is unchanged */
+  if ((num == overlay_bars) && (top == overlay_top) &&
+      (strncmp(label, overlay_label, LABEL_MAX_LENGTH) == 0) &&
+      (memcmp(bar, overlay_bar, (size_t)num * sizeof(bar[0])) == 0)) {
+    return;
+  }
+
+  fill_rect(area.x, area.y, area.width, area.height, color_background);
+
+  /* Label, centred (clipped to the overlay when too long) */
+  text_measure(&font_label, label, &width, NULL);
+  if (width > DISPLAY_OVERLAY_WIDTH) {
+    width = DISPLAY_OVERLAY_WIDTH;
+  }
+  text_draw(&font_label, overlay, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT, &area,
+            (DISPLAY_OVERLAY_WIDTH - width) / 2, OVERLAY_PADDING, label, color_text);
+
+  /* One confidence bar per class, class name clipped to BAR_NAME_LENGTH characters */
+  for (int i = 0; i < num; ++i) {
+    const text_rect_t name_area = { OVERLAY_PADDING, BARS_Y + i * BAR_ROW_HEIGHT,
+                                    BAR_NAME_LENGTH * TEXT_FONT_WIDTH, TEXT_FONT_HEIGHT };
+
+    text_draw(&font_small, overlay, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT, &name_area,
+              name_area.x, name_area.y, names[i], color_text);
+    fill_rect(BAR_X, name_area.y, BAR_MAX_WIDTH, TEXT_FONT_HEIGHT, color_bar_track);
+    fill_rect(BAR_X, name_area.y, bar[i], TEXT_FONT_HEIGHT, (i == top) ? color_bar_top : color_bar);
+  }
+
+  strncpy(overlay_label, label, LABEL_MAX_LENGTH);
+  overlay_label[LABEL_MAX_LENGTH] = '\0';
+  memcpy(overlay_bar, bar, (size_t)num * sizeof(bar[0]));
+  overlay_bars = num;
+  overlay_top  = top;
+  area_revision[AREA_RESULT]++;
+}
+
+void display_overlay_set_stats(const char *text) {
+  const text_rect_t area = { 0, STATS_Y, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT - STATS_Y };
+
+  /* Nothing to redraw when the text is unchanged */
+  if (strncmp(text, overlay_stats, sizeof(overlay_stats) - 1U) == 0) {
+    return;
+  }
+
+  fill_rect(area.x, area.y, area.width, area.height, color_background);
+  text_draw(&font_small, overlay, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT, &area,
+            OVERLAY_PADDING, STATS_Y, text, color_stats);
+
+  strncpy(overlay_stats, text, sizeof(overlay_stats) - 1U);
+  overlay_stats[sizeof(overlay_stats) - 1U] = '\0';
+  area_revision[AREA_STATS]++;
+}
+
+void display_overlay_draw(uint8_t *frame,
+                          int frame_width,
+                          int frame_height,
+                          int x_offset,
+                          int y_offset,
+                          int flip_horizontal,
+                          int flip_vertical,
+                          int swap_rb) {
+  overlay_frame_t *entry = NULL;
+
+  /* Areas composited into this frame buffer, a new frame buffer replaces the oldest entry */
+  for (int i = 0; i < DISPLAY_OVERLAY_MAX_FRAMES; ++i) {
+    if ((overlay_frames[i].frame == frame) &&
+        (overlay_frames[i].x_offset == x_offset) && (overlay_frames[i].y_offset == y_offset)) {
+      entry = &overlay_frames[i];
+      break;
+    }
+  }
+  if (entry == NULL) {
+    entry = &overlay_frames[overlay_frame_next];
+    overlay_frame_next = (overlay_frame_next + 1U) % DISPLAY_OVERLAY_MAX_FRAMES;
+    memset(entry, 0, sizeof(*entry));
+    entry->frame    = frame;
+    entry->x_offset = x_offset;
+    entry->y_offset = y_offset;
+  }
+
+  /* Copy only the areas changed since */
+  for (int i = 0; i < AREA_COUNT; ++i) {
+    if (entry->revision[i] == area_revision[i]) {
+      continue;
+    }
+    image_blit_rect(overlay, DISPLAY_OVERLAY_WIDTH, DISPLAY_OVERLAY_HEIGHT, IMAGE_FORMAT_RGB888,
+                    0, area_y[i], DISPLAY_OVERLAY_WIDTH, area_y[i + 1] - area_y[i],
+                    frame, frame_width, frame_height, x_offset, y_offset,
+                    flip_horizontal, flip_vertical, swap_rb);
+    entry->revision[i] = area_revision[i];
+  }
+}
@@ -0,0 +1,117 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef DISPLAY_OVERLAY_H__
+#define DISPLAY_OVERLAY_H__
+
+#include <stdint.h>
+
+/* Overlay width in pixels */
+#ifndef DISPLAY_OVERLAY_WIDTH
+#define DISPLAY_OVERLAY_WIDTH       224
+#endif
+
+/* Overlay height in pixels (label line, one confidence bar per class and statistics lines) */
+#ifndef DISPLAY_OVERLAY_HEIGHT
+#define DISPLAY_OVERLAY_HEIGHT      100
+#endif
+
+/* Maximum number of confidence bars */
+#ifndef DISPLAY_OVERLAY_MAX_BARS
+#define DISPLAY_OVERLAY_MAX_BARS    4
+#endif
+
+/* Maximum length of the statistics text, including the terminating null */
+#ifndef DISPLAY_OVERLAY_STATS_SIZE
+#define DISPLAY_OVERLAY_STATS_SIZE  96
+#endif
+
+/* Number of display frame buffers for which the composited overlay content is tracked */
+#ifndef DISPLAY_OVERLAY_MAX_FRAMES
+#define DISPLAY_OVERLAY_MAX_FRAMES  4
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Clear the overlay.
+ *
+ * The overlay is a small RGB888 image holding the classification label,
+ * the per-class confidence bars and statistics text. It is composited into the display frame
+ * next to the ML image, so the ML image itself is never drawn upon.
+ */
+void display_overlay_init(void);
+
+/**
+ * @brief Update the overlay with a classification result.
+ *
+ * The overlay is only redrawn when the label or a bar length changes.
+ *
+ * @param[in] label  Null-terminated label text.
+ * @param[in] probs  Class probabilities (0.0 .. 1.0).
+ * @param[in] names  Class names.
+ * @param[in] num    Number of classes (at most DISPLAY_OVERLAY_MAX_BARS bars are shown).
+ */
+void display_overlay_set_result(const char *label,
+                                const float *probs,
+                                const char *const *names,
+                                int num);
+
+/**
+ * @brief Update the statistics text of the overlay.
+ *
+ * Drawn below the confidence bars, clipped to the overlay; the area is only
+ * redrawn when the text changes.
+ *
+ * @param[in] text  Null-terminated text, '\n' starts a new line.
+ */
+void display_overlay_set_stats(const char *text);
+
+/**
+ * @brief Composite the overlay into a display frame (RGB888).
+ *
+ * Only the overlay areas that changed since the overlay was last composited
+ * into the same frame buffer at the same position are copied, so the overlay
+ * region of the frame buffer must not be written otherwise. Up to
+ * DISPLAY_OVERLAY_MAX_FRAMES frame buffers are tracked.
+ *
+ * @param[out] frame            Pointer to the display frame buffer.
+ * @param[in]  frame_width      Display frame width in pixels.
+ * @param[in]  frame_height     Display frame height in pixels.
+ * @param[in]  x_offset         Overlay left column in the display frame.
+ * @param[in]  y_offset         Overlay top row in the display frame.
+ * @param[in]  flip_horizontal  Mirror the overlay left-right if non-zero.
+ * @param[in]  flip_vertical    Mirror the overlay top-bottom if non-zero.
+ * @param[in]  swap_rb          Swap red and blue channels if non-zero.
+ */
+void display_overlay_draw(uint8_t *frame,
+                          int frame_width,
+                          int frame_height,
+                          int x_offset,
+                          int y_offset,
+                          int flip_horizontal,
+                          int flip_vertical,
+                          int swap_rb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_OVERLAY_H__ */
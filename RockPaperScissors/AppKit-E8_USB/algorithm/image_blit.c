@@ -0,0 +1,331 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Frame buffer blit with fused mirroring, red/blue swap and format conversion.
+
+  Overrides the __WEAK reference implementations of image_copy_to_framebuffer()
+  and image_blit_rect() in image_processing_func.c and produces the same
+  output. image_blit_rect() copies a rectangle of the source only, for
+  partial (dirty rectangle) updates.
+
+  Clipping against the frame buffer is resolved once per call, so every
+  destination row is a contiguous run read forwards or backwards from one
+  source row, without per-pixel bounds checks. The mirror and swap flags are
+  resolved once per call as well and select a row loop compiled for that
+  combination. RGB888 rows are processed four pixels (three words) at a time:
+  - no mirror, no swap: row copy, or a 2D DMA copy (see image_blit_dma_copy())
+  - swap:               byte shuffle within the three words
+  - mirror and swap:    reversing 12 bytes reverses the pixels and swaps red
+                        and blue, so the words are byte reversed (REV) and
+                        stored in reverse order
+  - mirror:             as mirror and swap, followed by the swap shuffle
+
+  Remove this file from the project to fall back to the reference code.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "cmsis_compiler.h"
+#include "image_processing_func.h"
+
+/* Swap red and blue of four RGB888 pixels held in three words */
+__STATIC_FORCEINLINE void rgb888_swap4(uint32_t *w0, uint32_t *w1, uint32_t *w2) {
+  const uint32_t a = *w0;
+  const uint32_t b = *w1;
+  const uint32_t c = *w2;
+
+  *w0 = ((a >> 16) & 0xFFU) | (a & 0xFF00U) | ((a & 0xFFU) << 16) | (((b >> 8) & 0xFFU) << 24);
+  *w1 = (b & 0xFFU) | ((a >> 24) << 8) | ((c & 0xFFU) << 16) | (b & 0xFF000000U);
+  *w2 = ((b >> 16) & 0xFFU) | ((c >> 24) << 8) | (c & 0xFF0000U) | (((c >> 8) & 0xFFU) << 24);
+}
+
+/*
+  Copy one row of n RGB888 pixels.
+  src points to the first pixel read, which is the rightmost one when mirrored.
+  flip and swap are constants after inlining, so only one case is compiled in.
+*/
+__STATIC_FORCEINLINE void blit_row_rgb888(const int flip, const int swap,
+                                          uint8_t *dst, const uint8_t *src, int n) {
+  if ((flip == 0) && (swap == 0)) {
+    memcpy(dst, src, (size_t)n * 3U);
+    return;
+  }
+
+  for (; n >= 4; n -= 4, dst += 12) {
+    uint32_t w0, w1, w2;
+
+    if (flip != 0) {
+      src -= 9;
+      w0 = __REV(__UNALIGNED_UINT32_READ(src + 8));
+      w1 = __REV(__UNALIGNED_UINT32_READ(src + 4));
+      w2 = __REV(__UNALIGNED_UINT32_READ(src));
+      src -= 3;
+      if (swap == 0) {
+        rgb888_swap4(&w0, &w1, &w2);
+      }
+    } else {
+      w0 = __UNALIGNED_UINT32_READ(src);
+      w1 = __UNALIGNED_UINT32_READ(src + 4);
+      w2 = __UNALIGNED_UINT32_READ(src + 8);
+      src += 12;
+      rgb888_swap4(&w0, &w1, &w2);
+    }
+    __UNALIGNED_UINT32_WRITE(dst,     w0);
+    __UNALIGNED_UINT32_WRITE(dst + 4, w1);
+    __UNALIGNED_UINT32_WRITE(dst + 8, w2);
+  }
+
+  for (; n > 0; --n, dst += 3) {
+    dst[0] = src[(swap != 0) ? 2 : 0];
+    dst[1] = src[1];
+    dst[2] = src[(swap != 0) ? 0 : 2];
+    src += (flip != 0) ? -3 : 3;
+  }
+}
+
+/* Convert one row of n RGB565 pixels to RGB888, channels expanded by bit replication */
+__STATIC_FORCEINLINE void blit_row_rgb565(const int flip, const int swap,
+                                          uint8_t *dst, const uint8_t *src, int n) {
+  for (; n > 0; --n, dst += 3) {
+    const uint32_t pixel = (uint32_t)src[0] | ((uint32_t)src[1] << 8);
+    const uint32_t r5    = (pixel >> 11) & 0x1FU;
+    const uint32_t g6    = (pixel >> 5)  & 0x3FU;
+    const uint32_t b5    =  pixel        & 0x1FU;
+    const uint8_t  r     = (uint8_t)((r5 << 3) | (r5 >> 2));
+    const uint8_t  g     = (uint8_t)((g6 << 2) | (g6 >> 4));
+    const uint8_t  b     = (uint8_t)((b5 << 3) | (b5 >> 2));
+
+    dst[0] = (swap != 0) ? b : r;
+    dst[1] = g;
+    dst[2] = (swap != 0) ? r : b;
+    src += (flip != 0) ? -2 : 2;
+  }
+}
+
+/* Convert one row of n grayscale pixels to RGB888 */
+__STATIC_FORCEINLINE void blit_row_gray(const int flip, uint8_t *dst, const uint8_t *src, int n) {
+  for (; n > 0; --n, dst += 3) {
+    dst[0] = *src;
+    dst[1] = *src;
+    dst[2] = *src;
+    src += (flip != 0) ? -1 : 1;
+  }
+}
+
+/* Copy one row of n pixels of bpp bytes without conversion */
+__STATIC_FORCEINLINE void blit_row_copy(const int flip, const int bpp,
+                                        uint8_t *dst, const uint8_t *src, int n) {
+  if (flip == 0) {
+    memcpy(dst, src, (size_t)n * (size_t)bpp);
+    return;
+  }
+  for (; n > 0; --n, dst += bpp, src -= bpp) {
+    for (int i = 0; i < bpp; ++i) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+/* Row loop of one source format, mirror and swap combination, to RGB888 */
+__STATIC_FORCEINLINE void blit_rows(const image_format_t format, const int flip, const int swap,
+                                    uint8_t *dst, int dst_stride,
+                                    const uint8_t *src, int src_stride,
+                                    int width, int height) {
+  for (; height > 0; --height, dst += dst_stride, src += src_stride) {
+    if (format == IMAGE_FORMAT_RGB888) {
+      blit_row_rgb888(flip, swap, dst, src, width);
+    } else if (format == IMAGE_FORMAT_RGB565) {
+      blit_row_rgb565(flip, swap, dst, src, width);
+    } else {
+      blit_row_gray(flip, dst, src, width);
+    }
+  }
+}
+
+/* Select the row loop compiled for the mirror and swap flags */
+#define BLIT_ROWS(format, flip, swap, ...)                                      \
+  switch (((flip) != 0 ? 1 : 0) | ((swap) != 0 ? 2 : 0)) {                      \
+    case 0:  blit_rows(format, 0, 0, __VA_ARGS__); break;                       \
+    case 1:  blit_rows(format, 1, 0, __VA_ARGS__); break;                       \
+    case 2:  blit_rows(format, 0, 1, __VA_ARGS__); break;                       \
+    default: blit_rows(format, 1, 1, __VA_ARGS__); break;                       \
+  }
+
+/*
+  Clip the source range [r0, r1) of one axis of an image of the given size,
+  placed at offset and mirrored within the image when flip is set, against a
+  destination of dst_size. Returns the number of destination pixels and sets
+  the first destination and corresponding source coordinate.
+*/
+static int clip_axis(int size, int r0, int r1, int dst_size, int offset, int flip,
+                     int *dst0, int *src0) {
+  int d0, d1;
+
+  if (r0 < 0)    { r0 = 0;    }
+  if (r1 > size) { r1 = size; }
+
+  if (flip != 0) {
+    d0 = offset + size - r1;
+    d1 = offset + size - r0;
+  } else {
+    d0 = offset + r0;
+    d1 = offset + r1;
+  }
+  if (d0 < 0)        { d0 = 0;        }
+  if (d1 > dst_size) { d1 = dst_size; }
+  if (d0 >= d1) {
+    return 0;
+  }
+
+  *dst0 = d0;
+  *src0 = (flip != 0) ? (offset + size - 1 - d0) : (d0 - offset);
+  return d1 - d0;
+}
+
+static int format_bpp(image_format_t format) {
+  switch (format) {
+    case IMAGE_FORMAT_GRAYSCALE:
+      return 1;
+    case IMAGE_FORMAT_RGB565:
+      return 2;
+    case IMAGE_FORMAT_RGB888:
+      return 3;
+    default:
+      return 0;
+  }
+}
+
+__WEAK int32_t image_blit_dma_copy(uint8_t *dst,
+                                   int32_t dst_stride,
+                                   const uint8_t *src,
+                                   int32_t src_stride,
+                                   uint32_t row_size,
+                                   uint32_t rows) {
+  (void)dst;
+  (void)dst_stride;
+  (void)src;
+  (void)src_stride;
+  (void)row_size;
+  (void)rows;
+  return -1;
+}
+
+void image_blit_rect(const uint8_t *src,
+                     int src_width,
+                     int src_height,
+                     image_format_t src_format,
+                     int rect_x,
+                     int rect_y,
+                     int rect_width,
+                     int rect_height,
+                     uint8_t *dst,
+                     int dst_width,
+                     int dst_height,
+                     int x_offset,
+                     int y_offset,
+                     int flip_horizontal,
+                     int flip_vertical,
+                     int swap_rb) {
+  const int bpp = format_bpp(src_format);
+  int       dst_x, dst_y, src_x, src_y;
+  int       width, height;
+  int       src_stride;
+
+  if (bpp == 0) {
+    return; // unsupported format
+  }
+
+  width  = clip_axis(src_width,  rect_x, rect_x + rect_width,  dst_width,  x_offset, flip_horizontal,
+                     &dst_x, &src_x);
+  height = clip_axis(src_height, rect_y, rect_y + rect_height, dst_height, y_offset, flip_vertical,
+                     &dst_y, &src_y);
+  if ((width <= 0) || (height <= 0)) {
+    return;
+  }
+
+  dst       += (dst_y * dst_width + dst_x) * 3;
+  src       += (src_y * src_width + src_x) * bpp;
+  src_stride = (flip_vertical != 0) ? -(src_width * bpp) : (src_width * bpp);
+
+  switch (src_format) {
+    case IMAGE_FORMAT_RGB888:
+      if ((flip_horizontal == 0) && (swap_rb == 0) &&
+          (image_blit_dma_copy(dst, dst_width * 3, src, src_stride, (uint32_t)width * 3U, (uint32_t)height) == 0)) {
+        break;
+      }
+      BLIT_ROWS(IMAGE_FORMAT_RGB888, flip_horizontal, swap_rb,
+                dst, dst_width * 3, src, src_stride, width, height);
+      break;
+    case IMAGE_FORMAT_RGB565:
+      BLIT_ROWS(IMAGE_FORMAT_RGB565, flip_horizontal, swap_rb,
+                dst, dst_width * 3, src, src_stride, width, height);
+      break;
+    default:
+      BLIT_ROWS(IMAGE_FORMAT_GRAYSCALE, flip_horizontal, 0,
+                dst, dst_width * 3, src, src_stride, width, height);
+      break;
+  }
+}
+
+void image_copy_to_framebuffer(const uint8_t *src,
+                               int src_width,
+                               int src_height,
+                               uint8_t *dst,
+                               int dst_width,
+                               int dst_height,
+                               int x_offset,
+                               int y_offset,
+                               image_format_t format,
+                               int flip_horizontal,
+                               int flip_vertical,
+                               int swap_rb) {
+  const int bpp = format_bpp(format);
+  int       dst_x, dst_y, src_x, src_y;
+  int       width, height;
+  int       src_stride;
+
+  if (format == IMAGE_FORMAT_RGB888) {
+    image_blit_rect(src, src_width, src_height, format, 0, 0, src_width, src_height,
+                    dst, dst_width, dst_height, x_offset, y_offset,
+                    flip_horizontal, flip_vertical, swap_rb);
+    return;
+  }
+  if (bpp == 0) {
+    return; // unsupported format
+  }
+
+  /* Grayscale and RGB565 frame buffers: copy without conversion (no channel swap) */
+  width  = clip_axis(src_width,  0, src_width,  dst_width,  x_offset, flip_horizontal, &dst_x, &src_x);
+  height = clip_axis(src_height, 0, src_height, dst_height, y_offset, flip_vertical,   &dst_y, &src_y);
+  if ((width <= 0) || (height <= 0)) {
+    return;
+  }
+
+  dst       += (dst_y * dst_width + dst_x) * bpp;
+  src       += (src_y * src_width + src_x) * bpp;
+  src_stride = (flip_vertical != 0) ? -(src_width * bpp) : (src_width * bpp);
+
+  for (; height > 0; --height, dst += dst_width * bpp, src += src_stride) {
+    if (flip_horizontal != 0) {
+      blit_row_copy(1, bpp, dst, src, width);
+    } else {
+      blit_row_copy(0, bpp, dst, src, width);
+    }
+  }
+}
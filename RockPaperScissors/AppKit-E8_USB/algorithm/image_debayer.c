@@ -0,0 +1,251 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Bayer pattern specialised debayering.
+
+  Overrides the __WEAK reference implementations of image_debayer() and
+  crop_and_debayer() in image_processing_func.c and produces the same output.
+  The Bayer pattern is resolved once per call (and the row parity once per
+  row), so the per-pixel colour site is a compile-time constant and the
+  inner loops have no pattern or parity branches.
+
+  Remove this file from the project to fall back to the reference code.
+*/
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+#include "image_processing_func.h"
+
+/* Colour site of a Bayer pixel */
+#define SITE_R      0   /* Red                  */
+#define SITE_GR     1   /* Green on a red row   */
+#define SITE_GB     2   /* Green on a blue row  */
+#define SITE_B      3   /* Blue                 */
+
+/* Maximum number of output columns handled per column block in crop_and_debayer */
+#ifndef DEBAYER_MAX_COLUMNS
+#define DEBAYER_MAX_COLUMNS     IMAGE_RESIZE_MAX_DST_SIZE
+#endif
+
+/* Colour site by [pattern][row parity][column parity] */
+static const uint8_t bayer_site[4][2][2] = {
+  [BAYER_PATTERN_RGGB] = { { SITE_R,  SITE_GR }, { SITE_GB, SITE_B  } },
+  [BAYER_PATTERN_BGGR] = { { SITE_B,  SITE_GB }, { SITE_GR, SITE_R  } },
+  [BAYER_PATTERN_GRBG] = { { SITE_GR, SITE_R  }, { SITE_B,  SITE_GB } },
+  [BAYER_PATTERN_GBRG] = { { SITE_GB, SITE_B  }, { SITE_R,  SITE_GR } }
+};
+
+/* Column tables of crop_and_debayer (source column and output columns per parity) */
+static uint16_t col_sx  [DEBAYER_MAX_COLUMNS];
+static uint16_t col_even[DEBAYER_MAX_COLUMNS];
+static uint16_t col_odd [DEBAYER_MAX_COLUMNS];
+
+/*
+  Interpolate one pixel at column x of the current row.
+  site is a constant after inlining, so only one case is compiled in.
+*/
+__STATIC_FORCEINLINE void debayer_pixel(const int site,
+                                        const uint8_t *up, const uint8_t *cur, const uint8_t *dn,
+                                        int x, uint8_t *out, int ri, int bi) {
+  int r, g, b;
+
+  if (site == SITE_R) {
+    r = cur[x];
+    g = (cur[x - 1] + cur[x + 1] + up[x] + dn[x]) >> 2;
+    b = (up[x - 1] + up[x + 1] + dn[x - 1] + dn[x + 1]) >> 2;
+  } else if (site == SITE_B) {
+    b = cur[x];
+    g = (cur[x - 1] + cur[x + 1] + up[x] + dn[x]) >> 2;
+    r = (up[x - 1] + up[x + 1] + dn[x - 1] + dn[x + 1]) >> 2;
+  } else if (site == SITE_GR) {
+    g = cur[x];
+    r = (cur[x - 1] + cur[x + 1]) >> 1;
+    b = (up[x] + dn[x]) >> 1;
+  } else {
+    g = cur[x];
+    r = (up[x] + dn[x]) >> 1;
+    b = (cur[x - 1] + cur[x + 1]) >> 1;
+  }
+
+  out[ri] = (uint8_t)r;
+  out[1]  = (uint8_t)g;
+  out[bi] = (uint8_t)b;
+}
+
+/*
+  Debayer columns 1 .. width-2 of one full resolution row, two pixels
+  (odd column, even column) per iteration, written in streaming order.
+*/
+__STATIC_FORCEINLINE void debayer_row(const int pattern, const int ry,
+                                      const uint8_t *up, const uint8_t *cur, const uint8_t *dn,
+                                      uint8_t *out, int width, int ri, int bi) {
+  const int site_odd  = bayer_site[pattern][ry][1];
+  const int site_even = bayer_site[pattern][ry][0];
+  int x;
+
+  out += 3;
+  for (x = 1; x < width - 2; x += 2, out += 6) {
+    debayer_pixel(site_odd,  up, cur, dn, x,     out,     ri, bi);
+    debayer_pixel(site_even, up, cur, dn, x + 1, out + 3, ri, bi);
+  }
+  if (x < width - 1) {
+    debayer_pixel(site_odd,  up, cur, dn, x,     out,     ri, bi);
+  }
+}
+
+/* Debayer rows 1 .. height-2, one odd and one even row per iteration */
+__STATIC_FORCEINLINE void debayer_image(const int pattern,
+                                        const uint8_t *raw, uint8_t *rgb,
+                                        int width, int height, int ri, int bi) {
+  int y;
+
+  for (y = 1; y < height - 2; y += 2) {
+    const uint8_t *row = &raw[y * width];
+    uint8_t       *out = &rgb[y * width * 3];
+
+    debayer_row(pattern, 1, row - width, row,         row + width,     out,             width, ri, bi);
+    debayer_row(pattern, 0, row,         row + width, row + 2 * width, out + width * 3, width, ri, bi);
+  }
+  if (y < height - 1) {
+    const uint8_t *row = &raw[y * width];
+
+    debayer_row(pattern, 1, row - width, row, row + width, &rgb[y * width * 3], width, ri, bi);
+  }
+}
+
+void image_debayer(const uint8_t *raw,
+                   uint8_t *rgb,
+                   int width,
+                   int height,
+                   bayer_pattern_t pattern,
+                   int swap_rb) {
+  int ri = (swap_rb == 0) ? 0 : 2;
+  int bi = 2 - ri;
+
+  switch (pattern) {
+    case BAYER_PATTERN_RGGB: debayer_image(BAYER_PATTERN_RGGB, raw, rgb, width, height, ri, bi); break;
+    case BAYER_PATTERN_BGGR: debayer_image(BAYER_PATTERN_BGGR, raw, rgb, width, height, ri, bi); break;
+    case BAYER_PATTERN_GRBG: debayer_image(BAYER_PATTERN_GRBG, raw, rgb, width, height, ri, bi); break;
+    case BAYER_PATTERN_GBRG: debayer_image(BAYER_PATTERN_GBRG, raw, rgb, width, height, ri, bi); break;
+  }
+}
+
+/*
+  Debayer the sampled pixels of one output row of crop_and_debayer.
+  Output columns are grouped by source column parity, so each loop handles
+  a single colour site.
+*/
+__STATIC_FORCEINLINE void crop_debayer_row(const int pattern, const int ry,
+                                           const uint8_t *up, const uint8_t *cur, const uint8_t *dn,
+                                           int n_even, int n_odd, uint8_t *out) {
+  const int site_even = bayer_site[pattern][ry][0];
+  const int site_odd  = bayer_site[pattern][ry][1];
+
+  for (int i = 0; i < n_even; ++i) {
+    int dx = col_even[i];
+    debayer_pixel(site_even, up, cur, dn, col_sx[dx], &out[dx * 3], 0, 2);
+  }
+  for (int i = 0; i < n_odd; ++i) {
+    int dx = col_odd[i];
+    debayer_pixel(site_odd,  up, cur, dn, col_sx[dx], &out[dx * 3], 0, 2);
+  }
+}
+
+/* Debayer one column block of all output rows */
+__STATIC_FORCEINLINE void crop_debayer_block(const int pattern,
+                                             const uint8_t *src, int src_width, int src_height, int src_crop_y,
+                                             uint8_t *dst_rgb, int dst_width, int dst_height,
+                                             int n_even, int n_odd) {
+  for (int dy = 0; dy < dst_height; ++dy) {
+    int sy = (((dy * (src_height - 2 - src_crop_y * 2)) << 8) / (dst_height - 1)) >> 8;
+
+    sy += src_crop_y;
+    if (sy < 1) {
+      sy = 1;
+    }
+    if (sy >= src_height - 2) {
+      sy = src_height - 2;
+    }
+
+    const uint8_t *cur = &src[sy * src_width];
+    uint8_t       *out = &dst_rgb[dy * dst_width * 3];
+
+    if ((sy & 1) == 0) {
+      crop_debayer_row(pattern, 0, cur - src_width, cur, cur + src_width, n_even, n_odd, out);
+    } else {
+      crop_debayer_row(pattern, 1, cur - src_width, cur, cur + src_width, n_even, n_odd, out);
+    }
+  }
+}
+
+void crop_and_debayer(const uint8_t *src,
+                      int src_width,
+                      int src_height,
+                      int src_crop_x,
+                      int src_crop_y,
+                      uint8_t *dst_rgb,
+                      int dst_width,
+                      int dst_height,
+                      bayer_pattern_t pattern) {
+
+  for (int c0 = 0; c0 < dst_width; c0 += DEBAYER_MAX_COLUMNS) {
+    int c1 = (dst_width - c0 > DEBAYER_MAX_COLUMNS) ? (c0 + DEBAYER_MAX_COLUMNS) : dst_width;
+    int n_even = 0;
+    int n_odd  = 0;
+
+    /* Source column of each output column, grouped by column parity */
+    for (int dx = c0; dx < c1; ++dx) {
+      int sx = (((dx * (src_width - 2 - src_crop_x * 2)) << 8) / (dst_width - 1)) >> 8;
+
+      sx += src_crop_x;
+      if (sx < 1) {
+        sx = 1;
+      }
+      if (sx >= src_width - 2) {
+        sx = src_width - 2;
+      }
+
+      col_sx[dx - c0] = (uint16_t)sx;
+      if ((sx & 1) == 0) {
+        col_even[n_even++] = (uint16_t)(dx - c0);
+      } else {
+        col_odd[n_odd++]   = (uint16_t)(dx - c0);
+      }
+    }
+
+    switch (pattern) {
+      case BAYER_PATTERN_RGGB:
+        crop_debayer_block(BAYER_PATTERN_RGGB, src, src_width, src_height, src_crop_y,
+                           &dst_rgb[c0 * 3], dst_width, dst_height, n_even, n_odd);
+        break;
+      case BAYER_PATTERN_BGGR:
+        crop_debayer_block(BAYER_PATTERN_BGGR, src, src_width, src_height, src_crop_y,
+                           &dst_rgb[c0 * 3], dst_width, dst_height, n_even, n_odd);
+        break;
+      case BAYER_PATTERN_GRBG:
+        crop_debayer_block(BAYER_PATTERN_GRBG, src, src_width, src_height, src_crop_y,
+                           &dst_rgb[c0 * 3], dst_width, dst_height, n_even, n_odd);
+        break;
+      case BAYER_PATTERN_GBRG:
+        crop_debayer_block(BAYER_PATTERN_GBRG, src, src_width, src_height, src_crop_y,
+                           &dst_rgb[c0 * 3], dst_width, dst_height, n_even, n_odd);
+        break;
+    }
+  }
+}
@@ -17,6 +17,8 @@
  *---------------------------------------------------------------------------*/
 
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include "cmsis_compiler.h"
 #include "image_processing_func.h"
 
@@ -245,7 +247,8 @@ __WEAK void crop_and_debayer(const uint8_t *src,
 
         case 1: // Green
           g = center;
-          if ((row_parity == 0 && col_parity == 1) || (row_parity == 1 && col_parity == 0)) {
+          if (offsets[row_parity][col_parity ^ 1] == 2) {
+            // Green on red row
             r = (p[sy * src_width + sx - 1] + p[sy * src_width + sx + 1]) / 2;
             b = (p[(sy - 1) * src_width + sx] + p[(sy + 1) * src_width + sx]) / 2;
           } else {
@@ -314,6 +317,70 @@ static void pack_pixel(uint8_t *buf, image_format_t format, int r, int g, int b)
   }
 }
 
+void crop_resize_to_rgb888(const uint8_t *src,
+                           int src_width,
+                           int src_height,
+                           image_format_t src_format,
+                           int crop_x,
+                           int crop_y,
+                           int crop_width,
+                           int crop_height,
+                           uint8_t *dst,
+                           int dst_width,
+                           int dst_height) {
+  int src_bpp = (src_format == IMAGE_FORMAT_GRAYSCALE) ? 1 :
+                (src_format == IMAGE_FORMAT_RGB565)    ? 2 : 3;
+
+  int x_ratio = ((crop_width - 1) << FP_SHIFT) / (dst_width - 1);
+  int y_ratio = ((crop_height - 1) << FP_SHIFT) / (dst_height - 1);
+
+  (void)src_height;
+
+  for (int y = 0; y < dst_height; ++y) {
+    int sy = ((y * y_ratio) >> FP_SHIFT) + crop_y;
+    const uint8_t *src_row = &src[(sy * src_width + crop_x) * src_bpp];
+    uint8_t *dst_pixel = &dst[y * dst_width * 3];
+
+    // Format is resolved per row so the inner loops stay branch-free
+    switch (src_format) {
+      case IMAGE_FORMAT_RGB565:
+        for (int x = 0; x < dst_width; ++x, dst_pixel += 3) {
+          const uint8_t *p = &src_row[((x * x_ratio) >> FP_SHIFT) * 2];
+          uint16_t pixel = p[0] | (p[1] << 8);
+
+          uint8_t r5 = (pixel >> 11) & 0x1F;
+          uint8_t g6 = (pixel >> 5)  & 0x3F;
+          uint8_t b5 = pixel & 0x1F;
+
+          dst_pixel[0] = (r5 << 3) | (r5 >> 2);
+          dst_pixel[1] = (g6 << 2) | (g6 >> 4);
+          dst_pixel[2] = (b5 << 3) | (b5 >> 2);
+        }
+        break;
+
+      case IMAGE_FORMAT_RGB888:
+        for (int x = 0; x < dst_width; ++x, dst_pixel += 3) {
+          const uint8_t *p = &src_row[((x * x_ratio) >> FP_SHIFT) * 3];
+
+          dst_pixel[0] = p[0];
+          dst_pixel[1] = p[1];
+          dst_pixel[2] = p[2];
+        }
+        break;
+
+      case IMAGE_FORMAT_GRAYSCALE:
+        for (int x = 0; x < dst_width; ++x, dst_pixel += 3) {
+          uint8_t v = src_row[(x * x_ratio) >> FP_SHIFT];
+
+          dst_pixel[0] = v;
+          dst_pixel[1] = v;
+          dst_pixel[2] = v;
+        }
+        break;
+    }
+  }
+}
+
 void crop_resize_rgb565_to_rgb888(
     const uint8_t *src,
     int src_width,
@@ -326,31 +393,276 @@ void crop_resize_rgb565_to_rgb888(
     int crop_x = (src_width - crop_size) / 2;   // center horizontally
     int crop_y = 0;
 
-    int x_ratio = ((crop_size - 1) << FP_SHIFT) / (dst_width - 1);
-    int y_ratio = ((crop_size - 1) << FP_SHIFT) / (dst_height - 1);
+    crop_resize_to_rgb888(src, src_width, src_height, IMAGE_FORMAT_RGB565,
+                          crop_x, crop_y, crop_size, crop_size,
+                          dst, dst_width, dst_height);
+}
+
+/* Expand an RGB565 pixel to RGB888 by bit replication */
+static inline void unpack_rgb565(const uint8_t *p, int *r, int *g, int *b) {
+  uint16_t px = p[0] | (p[1] << 8);
+  int r5 = (px >> 11) & 0x1F;
+  int g6 = (px >> 5)  & 0x3F;
+  int b5 = px & 0x1F;
+
+  *r = (r5 << 3) | (r5 >> 2);
+  *g = (g6 << 2) | (g6 >> 4);
+  *b = (b5 << 3) | (b5 >> 2);
+}
+
+/* Bilinear blend of four samples, weights in 1/256 */
+static inline uint8_t blend_bilinear(int c00, int c01, int c10, int c11, int wx, int wy) {
+  int top = c00 * (256 - wx) + c01 * wx;
+  int bot = c10 * (256 - wx) + c11 * wx;
+
+  return (uint8_t)((top * (256 - wy) + bot * wy + 32768) >> 16);
+}
+
+/*
+  Build the source index and weight tables of one axis.
+
+  Nearest:  i0 = sampled position.
+  Bilinear: i0/i1 = neighbouring positions, w = weight of i1 in 1/256.
+  Area:     [i0, i1) = covered positions, w = 65536 / (i1 - i0).
+*/
+static void resize_plan_axis(uint16_t *i0, uint16_t *i1, uint32_t *w,
+                             int src_size, int dst_size, image_resize_mode_t mode) {
+  int ratio = (dst_size > 1) ? ((src_size - 1) << FP_SHIFT) / (dst_size - 1) : 0;
+
+  for (int d = 0; d < dst_size; ++d) {
+    if (mode == IMAGE_RESIZE_AREA) {
+      int start = (d * src_size) / dst_size;
+      int end   = ((d + 1) * src_size) / dst_size;
+      if (end <= start) {
+        end = start + 1;
+      }
+      i0[d] = (uint16_t)start;
+      i1[d] = (uint16_t)end;
+      w[d]  = (uint32_t)((FP_ONE + ((end - start) >> 1)) / (end - start));
+    } else {
+      int pos_fp = d * ratio;
+      int pos    = pos_fp >> FP_SHIFT;
+      i0[d] = (uint16_t)pos;
+      i1[d] = (uint16_t)((pos < src_size - 1) ? pos + 1 : pos);
+      w[d]  = (uint32_t)((pos_fp & FP_MASK) >> (FP_SHIFT - 8));
+    }
+  }
+}
+
+int image_resize_plan_init(image_resize_plan_t *plan,
+                           int src_width,
+                           int src_height,
+                           image_format_t src_format,
+                           int crop_x,
+                           int crop_y,
+                           int crop_width,
+                           int crop_height,
+                           int dst_width,
+                           int dst_height,
+                           image_resize_mode_t mode) {
+  if ((plan == NULL) ||
+      (crop_x < 0) || (crop_y < 0) || (crop_width < 1) || (crop_height < 1) ||
+      ((crop_x + crop_width) > src_width) || ((crop_y + crop_height) > src_height) ||
+      (dst_width  < 1) || (dst_width  > IMAGE_RESIZE_MAX_DST_SIZE) ||
+      (dst_height < 1) || (dst_height > IMAGE_RESIZE_MAX_DST_SIZE) ||
+      (crop_width > IMAGE_RESIZE_MAX_CROP_WIDTH)) {
+    return -1;
+  }
+  if ((src_format != IMAGE_FORMAT_GRAYSCALE) &&
+      (src_format != IMAGE_FORMAT_RGB565) &&
+      (src_format != IMAGE_FORMAT_RGB888)) {
+    return -1;
+  }
+  if ((mode != IMAGE_RESIZE_NEAREST) && (mode != IMAGE_RESIZE_BILINEAR) && (mode != IMAGE_RESIZE_AREA)) {
+    return -1;
+  }
 
-    for (int y = 0; y < dst_height; y++) {
-        int src_y_fp = y * y_ratio;
-        int sy = (src_y_fp >> FP_SHIFT) + crop_y;
+  plan->src_width   = src_width;
+  plan->src_height  = src_height;
+  plan->src_format  = src_format;
+  plan->src_bpp     = (src_format == IMAGE_FORMAT_GRAYSCALE) ? 1 :
+                      (src_format == IMAGE_FORMAT_RGB565)    ? 2 : 3;
+  plan->crop_x      = crop_x;
+  plan->crop_y      = crop_y;
+  plan->crop_width  = crop_width;
+  plan->crop_height = crop_height;
+  plan->dst_width   = dst_width;
+  plan->dst_height  = dst_height;
+  plan->mode        = mode;
+
+  resize_plan_axis(plan->x0, plan->x1, plan->wx, crop_width,  dst_width,  mode);
+  resize_plan_axis(plan->y0, plan->y1, plan->wy, crop_height, dst_height, mode);
+
+  return 0;
+}
 
-        for (int x = 0; x < dst_width; x++) {
-            int src_x_fp = x * x_ratio;
-            int sx = (src_x_fp >> FP_SHIFT) + crop_x;
+/* Nearest-neighbour resampling of one output row */
+static void resize_row_nearest(const image_resize_plan_t *plan, const uint8_t *row, uint8_t *dst) {
+  const uint16_t *x0 = plan->x0;
+  int n = plan->dst_width;
 
-            int idx = (sy * src_width + sx) * 2;
-            uint16_t pixel = src[idx] | (src[idx + 1] << 8);
+  switch (plan->src_format) {
+    case IMAGE_FORMAT_RGB565:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        int r, g, b;
+        unpack_rgb565(&row[x0[x] * 2], &r, &g, &b);
+        dst[0] = (uint8_t)r;
+        dst[1] = (uint8_t)g;
+        dst[2] = (uint8_t)b;
+      }
+      break;
 
-            uint8_t r5 = (pixel >> 11) & 0x1F;
-            uint8_t g6 = (pixel >> 5)  & 0x3F;
-            uint8_t b5 = pixel & 0x1F;
+    case IMAGE_FORMAT_RGB888:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        const uint8_t *p = &row[x0[x] * 3];
+        dst[0] = p[0];
+        dst[1] = p[1];
+        dst[2] = p[2];
+      }
+      break;
 
-            uint8_t *dst_pixel = &dst[(y * dst_width + x) * 3];
+    case IMAGE_FORMAT_GRAYSCALE:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        uint8_t v = row[x0[x]];
+        dst[0] = v;
+        dst[1] = v;
+        dst[2] = v;
+      }
+      break;
+  }
+}
+
+/* Bilinear resampling of one output row from two source rows */
+static void resize_row_bilinear(const image_resize_plan_t *plan,
+                                const uint8_t *row0, const uint8_t *row1, int wy, uint8_t *dst) {
+  const uint16_t *x0 = plan->x0;
+  const uint16_t *x1 = plan->x1;
+  const uint32_t *wx = plan->wx;
+  int n = plan->dst_width;
+
+  switch (plan->src_format) {
+    case IMAGE_FORMAT_RGB565:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        int r00, g00, b00, r01, g01, b01, r10, g10, b10, r11, g11, b11;
+        int w = (int)wx[x];
+        unpack_rgb565(&row0[x0[x] * 2], &r00, &g00, &b00);
+        unpack_rgb565(&row0[x1[x] * 2], &r01, &g01, &b01);
+        unpack_rgb565(&row1[x0[x] * 2], &r10, &g10, &b10);
+        unpack_rgb565(&row1[x1[x] * 2], &r11, &g11, &b11);
+        dst[0] = blend_bilinear(r00, r01, r10, r11, w, wy);
+        dst[1] = blend_bilinear(g00, g01, g10, g11, w, wy);
+        dst[2] = blend_bilinear(b00, b01, b10, b11, w, wy);
+      }
+      break;
 
-            dst_pixel[0] = (r5 << 3) | (r5 >> 2);
-            dst_pixel[1] = (g6 << 2) | (g6 >> 4);
-            dst_pixel[2] = (b5 << 3) | (b5 >> 2);
+    case IMAGE_FORMAT_RGB888:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        const uint8_t *p00 = &row0[x0[x] * 3];
+        const uint8_t *p01 = &row0[x1[x] * 3];
+        const uint8_t *p10 = &row1[x0[x] * 3];
+        const uint8_t *p11 = &row1[x1[x] * 3];
+        int w = (int)wx[x];
+        dst[0] = blend_bilinear(p00[0], p01[0], p10[0], p11[0], w, wy);
+        dst[1] = blend_bilinear(p00[1], p01[1], p10[1], p11[1], w, wy);
+        dst[2] = blend_bilinear(p00[2], p01[2], p10[2], p11[2], w, wy);
+      }
+      break;
+
+    case IMAGE_FORMAT_GRAYSCALE:
+      for (int x = 0; x < n; ++x, dst += 3) {
+        uint8_t v = blend_bilinear(row0[x0[x]], row0[x1[x]], row1[x0[x]], row1[x1[x]], (int)wx[x], wy);
+        dst[0] = v;
+        dst[1] = v;
+        dst[2] = v;
+      }
+      break;
+  }
+}
+
+/* Add one source row to the column accumulator (3 channels per column, 32-bit for any row span) */
+static void resize_accumulate_row(const image_resize_plan_t *plan, const uint8_t *row, uint32_t *acc) {
+  int n = plan->crop_width;
+
+  switch (plan->src_format) {
+    case IMAGE_FORMAT_RGB565:
+      for (int x = 0; x < n; ++x, row += 2, acc += 3) {
+        int r, g, b;
+        unpack_rgb565(row, &r, &g, &b);
+        acc[0] += (uint32_t)r;
+        acc[1] += (uint32_t)g;
+        acc[2] += (uint32_t)b;
+      }
+      break;
+
+    case IMAGE_FORMAT_RGB888:
+      for (int x = 0; x < n; ++x, row += 3, acc += 3) {
+        acc[0] += row[0];
+        acc[1] += row[1];
+        acc[2] += row[2];
+      }
+      break;
+
+    case IMAGE_FORMAT_GRAYSCALE:
+      for (int x = 0; x < n; ++x, row += 1, acc += 3) {
+        acc[0] += row[0];
+        acc[1] += row[0];
+        acc[2] += row[0];
+      }
+      break;
+  }
+}
+
+/* Area average of one output row from the column accumulator */
+static void resize_row_area(const image_resize_plan_t *plan, const uint32_t *acc, uint32_t wy, uint8_t *dst) {
+  int n = plan->dst_width;
+
+  for (int x = 0; x < n; ++x, dst += 3) {
+    uint32_t r = 0U, g = 0U, b = 0U;
+    for (int sx = plan->x0[x]; sx < plan->x1[x]; ++sx) {
+      r += acc[sx * 3 + 0];
+      g += acc[sx * 3 + 1];
+      b += acc[sx * 3 + 2];
+    }
+    // Average over columns, then over rows (both weights are 65536 / span),
+    // the column sum times its weight needs 64 bits beyond 257 rows
+    r = ((uint32_t)(((uint64_t)r * plan->wx[x] + 32768U) >> 16) * wy + 32768U) >> 16;
+    g = ((uint32_t)(((uint64_t)g * plan->wx[x] + 32768U) >> 16) * wy + 32768U) >> 16;
+    b = ((uint32_t)(((uint64_t)b * plan->wx[x] + 32768U) >> 16) * wy + 32768U) >> 16;
+    dst[0] = (uint8_t)((r > 255U) ? 255U : r);
+    dst[1] = (uint8_t)((g > 255U) ? 255U : g);
+    dst[2] = (uint8_t)((b > 255U) ? 255U : b);
+  }
+}
+
+void image_resize_plan_run(image_resize_plan_t *plan, const uint8_t *src, uint8_t *dst) {
+  int row_stride = plan->src_width * plan->src_bpp;
+  const uint8_t *crop = &src[plan->crop_y * row_stride + plan->crop_x * plan->src_bpp];
+
+  for (int y = 0; y < plan->dst_height; ++y) {
+    uint8_t *dst_row = &dst[y * plan->dst_width * 3];
+
+    switch (plan->mode) {
+      case IMAGE_RESIZE_NEAREST:
+        resize_row_nearest(plan, &crop[plan->y0[y] * row_stride], dst_row);
+        break;
+
+      case IMAGE_RESIZE_BILINEAR:
+        resize_row_bilinear(plan,
+                            &crop[plan->y0[y] * row_stride],
+                            &crop[plan->y1[y] * row_stride],
+                            (int)plan->wy[y],
+                            dst_row);
+        break;
+
+      case IMAGE_RESIZE_AREA:
+        memset(plan->acc, 0, (size_t)plan->crop_width * 3U * sizeof(plan->acc[0]));
+        for (int sy = plan->y0[y]; sy < plan->y1[y]; ++sy) {
+          resize_accumulate_row(plan, &crop[sy * row_stride], plan->acc);
         }
+        resize_row_area(plan, plan->acc, plan->wy[y], dst_row);
+        break;
     }
+  }
 }
 
 __WEAK void image_resize(const uint8_t *src,
@@ -471,6 +783,77 @@ __WEAK void image_copy_to_framebuffer(const uint8_t *src,
   }
 }
 
+__WEAK void image_blit_rect(const uint8_t *src,
+                            int src_width,
+                            int src_height,
+                            image_format_t src_format,
+                            int rect_x,
+                            int rect_y,
+                            int rect_width,
+                            int rect_height,
+                            uint8_t *dst,
+                            int dst_width,
+                            int dst_height,
+                            int x_offset,
+                            int y_offset,
+                            int flip_horizontal,
+                            int flip_vertical,
+                            int swap_rb) {
+  int bpp;
+
+  switch (src_format) {
+    case IMAGE_FORMAT_GRAYSCALE:
+      bpp = 1;
+      break;
+    case IMAGE_FORMAT_RGB565:
+      bpp = 2;
+      break;
+    case IMAGE_FORMAT_RGB888:
+      bpp = 3;
+      break;
+    default:
+      return; // unsupported format
+  }
+
+  for (int y = 0; y < src_height; ++y) {
+    int dst_y = y + y_offset;
+    int src_y = flip_vertical ? (src_height - 1 - y) : y;
+    if (dst_y < 0 || dst_y >= dst_height || src_y < rect_y || src_y >= rect_y + rect_height)
+      continue;
+
+    for (int x = 0; x < src_width; ++x) {
+      int dst_x = x + x_offset;
+      int src_x = flip_horizontal ? (src_width - 1 - x) : x;
+      if (dst_x < 0 || dst_x >= dst_width || src_x < rect_x || src_x >= rect_x + rect_width)
+        continue;
+
+      const uint8_t *s = &src[(src_y * src_width + src_x) * bpp];
+      uint8_t       *d = &dst[(dst_y * dst_width + dst_x) * 3];
+      uint8_t r, g, b;
+
+      if (src_format == IMAGE_FORMAT_RGB888) {
+        r = s[0];
+        g = s[1];
+        b = s[2];
+      } else if (src_format == IMAGE_FORMAT_RGB565) {
+        uint16_t pixel = s[0] | (s[1] << 8);
+        uint8_t  r5    = (pixel >> 11) & 0x1F;
+        uint8_t  g6    = (pixel >> 5) & 0x3F;
+        uint8_t  b5    = pixel & 0x1F;
+        r = (r5 << 3) | (r5 >> 2);  // replicate upper bits
+        g = (g6 << 2) | (g6 >> 4);
+        b = (b5 << 3) | (b5 >> 2);
+      } else {
+        r = g = b = s[0];
+      }
+
+      d[0] = swap_rb ? b : r;
+      d[1] = g;
+      d[2] = swap_rb ? r : b;
+    }
+  }
+}
+
 __WEAK void convert_rgb565_to_rgb888(const uint8_t *src,
                                      uint8_t *dst,
                                      int width,
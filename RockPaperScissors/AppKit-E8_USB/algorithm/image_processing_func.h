@@ -32,12 +32,57 @@
 #define IMAGE_FORMAT_RGB565     1   ///< 16-bit RGB: 5 bits R, 6 bits G, 5 bits B
 #define IMAGE_FORMAT_RGB888     2   ///< 24-bit RGB: 8 bits each for R, G, B
 
+/* Resize mode definitions */
+#define IMAGE_RESIZE_NEAREST    0   ///< Nearest-neighbour sampling
+#define IMAGE_RESIZE_BILINEAR   1   ///< Bilinear interpolation, corners aligned
+#define IMAGE_RESIZE_AREA       2   ///< Average of all covered source pixels (downscaling)
+
+/* Maximum destination width and height supported by a resize plan */
+#ifndef IMAGE_RESIZE_MAX_DST_SIZE
+#define IMAGE_RESIZE_MAX_DST_SIZE   512
+#endif
+
+/* Maximum crop width supported by a resize plan (area mode accumulator) */
+#ifndef IMAGE_RESIZE_MAX_CROP_WIDTH
+#define IMAGE_RESIZE_MAX_CROP_WIDTH 1280
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef int bayer_pattern_t;
 typedef int image_format_t;
+typedef int image_resize_mode_t;
+
+/**
+ * @brief Precomputed resampling of a crop region to an RGB888 image.
+ *
+ * Holds per-column and per-row source indices and weights for one
+ * (source, crop, destination, format, mode) combination, so that
+ * @ref image_resize_plan_run does no per-pixel division or format dispatch.
+ * Build it once with @ref image_resize_plan_init.
+ */
+typedef struct {
+  int                 src_width;                            ///< Source width in pixels
+  int                 src_height;                           ///< Source height in pixels
+  image_format_t      src_format;                           ///< Source format
+  int                 src_bpp;                              ///< Source bytes per pixel
+  int                 crop_x;                               ///< Crop region left column
+  int                 crop_y;                               ///< Crop region top row
+  int                 crop_width;                           ///< Crop region width
+  int                 crop_height;                          ///< Crop region height
+  int                 dst_width;                            ///< Destination width in pixels
+  int                 dst_height;                           ///< Destination height in pixels
+  image_resize_mode_t mode;                                 ///< Resize mode
+  uint16_t            x0[IMAGE_RESIZE_MAX_DST_SIZE];        ///< First source column (crop relative)
+  uint16_t            x1[IMAGE_RESIZE_MAX_DST_SIZE];        ///< Second (bilinear) or end (area) source column
+  uint32_t            wx[IMAGE_RESIZE_MAX_DST_SIZE];        ///< Column weight
+  uint16_t            y0[IMAGE_RESIZE_MAX_DST_SIZE];        ///< First source row (crop relative)
+  uint16_t            y1[IMAGE_RESIZE_MAX_DST_SIZE];        ///< Second (bilinear) or end (area) source row
+  uint32_t            wy[IMAGE_RESIZE_MAX_DST_SIZE];        ///< Row weight
+  uint32_t            acc[IMAGE_RESIZE_MAX_CROP_WIDTH * 3]; ///< Area mode column accumulator
+} image_resize_plan_t;
 
 /**
  * @brief Perform debayering on a raw Bayer image.
@@ -93,6 +138,95 @@ void crop_and_debayer(const uint8_t *src,
                       int dst_height,
                       bayer_pattern_t pattern);
 
+/**
+ * @brief Crop a region from an image, resize it and convert it to RGB888 in one pass.
+ *
+ * The crop region is sampled with fixed-point nearest-neighbour interpolation
+ * so that its corners map onto the corners of the destination image. Source
+ * pixels are expanded to RGB888 while sampling, RGB565 channels are expanded
+ * by bit replication and grayscale is replicated into all three channels.
+ *
+ * Only the sampled source pixels are read and no intermediate buffer is used.
+ *
+ * @param src          Pointer to the source image buffer.
+ * @param src_width    Width of the source image in pixels.
+ * @param src_height   Height of the source image in pixels.
+ * @param src_format   Format of the source image (GRAYSCALE, RGB565, or RGB888).
+ * @param crop_x       X coordinate of the top-left corner of the crop region.
+ * @param crop_y       Y coordinate of the top-left corner of the crop region.
+ * @param crop_width   Width of the crop region in pixels.
+ * @param crop_height  Height of the crop region in pixels.
+ * @param dst          Pointer to the destination image buffer (RGB888 format).
+ * @param dst_width    Width of the destination image in pixels.
+ * @param dst_height   Height of the destination image in pixels.
+ *
+ * @note The crop region must lie within the source image.
+ * @note The destination buffer must be preallocated with at least
+ *       `dst_width * dst_height * 3` bytes.
+ */
+void crop_resize_to_rgb888(const uint8_t *src,
+                           int src_width,
+                           int src_height,
+                           image_format_t src_format,
+                           int crop_x,
+                           int crop_y,
+                           int crop_width,
+                           int crop_height,
+                           uint8_t *dst,
+                           int dst_width,
+                           int dst_height);
+
+/**
+ * @brief Build a resize plan for a crop region of an image.
+ *
+ * Precomputes the source column and row indices and weights used to
+ * resample the crop region to a dst_width x dst_height RGB888 image:
+ * - IMAGE_RESIZE_NEAREST samples one source pixel per output pixel.
+ * - IMAGE_RESIZE_BILINEAR blends the four neighbouring source pixels
+ *   (corners of the crop region map onto corners of the output).
+ * - IMAGE_RESIZE_AREA averages all source pixels covered by the output
+ *   pixel, reading every crop pixel exactly once. Use it for large
+ *   downscales where the other modes alias.
+ *
+ * @param[out] plan         Pointer to the plan to build.
+ * @param[in]  src_width    Width of the source image in pixels.
+ * @param[in]  src_height   Height of the source image in pixels.
+ * @param[in]  src_format   Format of the source image (GRAYSCALE, RGB565, or RGB888).
+ * @param[in]  crop_x       X coordinate of the top-left corner of the crop region.
+ * @param[in]  crop_y       Y coordinate of the top-left corner of the crop region.
+ * @param[in]  crop_width   Width of the crop region in pixels (up to IMAGE_RESIZE_MAX_CROP_WIDTH).
+ * @param[in]  crop_height  Height of the crop region in pixels.
+ * @param[in]  dst_width    Width of the destination image in pixels (up to IMAGE_RESIZE_MAX_DST_SIZE).
+ * @param[in]  dst_height   Height of the destination image in pixels (up to IMAGE_RESIZE_MAX_DST_SIZE).
+ * @param[in]  mode         Resize mode (NEAREST, BILINEAR, or AREA).
+ * @return     0 on success; -1 on invalid parameters
+ */
+int image_resize_plan_init(image_resize_plan_t *plan,
+                           int src_width,
+                           int src_height,
+                           image_format_t src_format,
+                           int crop_x,
+                           int crop_y,
+                           int crop_width,
+                           int crop_height,
+                           int dst_width,
+                           int dst_height,
+                           image_resize_mode_t mode);
+
+/**
+ * @brief Resample an image with a prebuilt resize plan.
+ *
+ * Processes the output row by row with inner loops specialised for the
+ * source format. The destination is always RGB888.
+ *
+ * @param[in]  plan  Pointer to a plan built by @ref image_resize_plan_init.
+ *                   Area mode uses the plan accumulator, so a plan must not
+ *                   be run from two threads at the same time.
+ * @param[in]  src   Pointer to the source image buffer.
+ * @param[out] dst   Pointer to the destination buffer (dst_width * dst_height * 3 bytes).
+ */
+void image_resize_plan_run(image_resize_plan_t *plan, const uint8_t *src, uint8_t *dst);
+
 /**
  * @brief Center-crop and resize an RGB565 image to RGB888 format.
  *
@@ -193,6 +327,75 @@ void image_copy_to_framebuffer(const uint8_t *src,
                                int swap_rb);
 
 
+/**
+ * @brief Copy a rectangle of an image into an RGB888 frame buffer.
+ *
+ * Mirroring, red/blue swap and conversion of the source format to RGB888 are
+ * applied in the same pass. The image is placed at (x_offset, y_offset) and
+ * mirrored within its own bounds, as in @ref image_copy_to_framebuffer, but
+ * only the frame buffer pixels covered by the rectangle are written. Use it
+ * to update only the changed (dirty) part of an image already in the frame.
+ *
+ * @param src              Pointer to the source image buffer.
+ * @param src_width        Width of the source image in pixels.
+ * @param src_height       Height of the source image in pixels.
+ * @param src_format       Format of the source image (GRAYSCALE, RGB565, or RGB888).
+ * @param rect_x           X coordinate of the top-left corner of the rectangle (source image).
+ * @param rect_y           Y coordinate of the top-left corner of the rectangle (source image).
+ * @param rect_width       Width of the rectangle in pixels.
+ * @param rect_height      Height of the rectangle in pixels.
+ * @param dst              Pointer to the destination frame buffer (RGB888).
+ * @param dst_width        Width of the destination frame buffer in pixels.
+ * @param dst_height       Height of the destination frame buffer in pixels.
+ * @param x_offset         X offset in the frame buffer of the source image.
+ * @param y_offset         Y offset in the frame buffer of the source image.
+ * @param flip_horizontal  Mirror the image left-right if non-zero.
+ * @param flip_vertical    Mirror the image top-bottom if non-zero.
+ * @param swap_rb          Swap red and blue channels if non-zero.
+ *
+ * @note The rectangle is clipped to the source image and the frame buffer.
+ */
+void image_blit_rect(const uint8_t *src,
+                     int src_width,
+                     int src_height,
+                     image_format_t src_format,
+                     int rect_x,
+                     int rect_y,
+                     int rect_width,
+                     int rect_height,
+                     uint8_t *dst,
+                     int dst_width,
+                     int dst_height,
+                     int x_offset,
+                     int y_offset,
+                     int flip_horizontal,
+                     int flip_vertical,
+                     int swap_rb);
+
+/**
+ * @brief Copy rows of bytes with DMA (optional).
+ *
+ * Called by @ref image_blit_rect for RGB888 copies without mirroring or
+ * channel swap. The default (__WEAK) implementation returns -1 and the rows
+ * are copied by the CPU. A device specific implementation may program a 2D
+ * DMA transfer; it must return 0 only once the copy has completed.
+ *
+ * @param dst         Pointer to the first destination row.
+ * @param dst_stride  Distance between destination rows in bytes.
+ * @param src         Pointer to the first source row.
+ * @param src_stride  Distance between source rows in bytes (negative when rows are read bottom-up).
+ * @param row_size    Number of bytes per row.
+ * @param rows        Number of rows.
+ * @return 0 when the rows have been copied, -1 when the CPU shall copy them.
+ */
+int32_t image_blit_dma_copy(uint8_t *dst,
+                            int32_t dst_stride,
+                            const uint8_t *src,
+                            int32_t src_stride,
+                            uint32_t row_size,
+                            uint32_t rows);
+
+
 /**
  * @brief Convert an RGB565 image to RGB888 format.
  *
@@ -0,0 +1,178 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Latency histograms.
+
+  Each stage has a fixed-size histogram of cycle counts with logarithmic
+  buckets: values below 2^LATENCY_HIST_SUB_BITS have a bucket each, above
+  that every power of two is split into 2^LATENCY_HIST_SUB_BITS buckets,
+  so a percentile is known to within 1 / 2^LATENCY_HIST_SUB_BITS of its
+  value (12.5% with the default). A reset only advances a generation
+  number; the histogram is cleared by the thread adding its next sample.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "latency_hist.h"
+#include "profiler.h"
+
+#define LATENCY_HIST_SUB    (1UL << LATENCY_HIST_SUB_BITS)
+
+/* Latency histogram of one stage */
+typedef struct {
+  uint32_t generation;                          /* Reset generation of the samples */
+  uint32_t count;                               /* Number of samples */
+  uint32_t min;                                 /* Minimum cycles */
+  uint32_t max;                                 /* Maximum cycles */
+  uint32_t bucket[LATENCY_HIST_BUCKETS];        /* Samples per bucket */
+} latency_hist_t;
+
+#if ENABLE_TIME_PROFILING
+
+static const char *const latency_stage_names[LATENCY_NUM_STAGES] = {
+  "Capture",
+  "Pre Processing",
+  "Inference",
+  "Post Process",
+  "Display",
+  "Total usecase"
+};
+
+static latency_hist_t    latency_hist[LATENCY_NUM_STAGES];
+static volatile uint32_t latency_generation;
+
+/* Bucket index of a cycle count */
+static uint32_t latency_bucket (uint32_t cycles) {
+  uint32_t exp;
+
+  if (cycles < LATENCY_HIST_SUB) {
+    return cycles;
+  }
+  exp = 31U - (uint32_t)__builtin_clz(cycles);
+  return ((exp - LATENCY_HIST_SUB_BITS + 1U) << LATENCY_HIST_SUB_BITS) +
+         ((cycles >> (exp - LATENCY_HIST_SUB_BITS)) - LATENCY_HIST_SUB);
+}
+
+/* Largest cycle count of a bucket */
+static uint32_t latency_bucket_max (uint32_t index) {
+  uint32_t shift;
+
+  if (index < LATENCY_HIST_SUB) {
+    return index;
+  }
+  shift = (index >> LATENCY_HIST_SUB_BITS) - 1U;
+  return (uint32_t)((((uint64_t)(index & (LATENCY_HIST_SUB - 1U)) + LATENCY_HIST_SUB + 1U) << shift) - 1U);
+}
+
+/* Cycle count at or below which the given per mille of the samples lie */
+static uint32_t latency_percentile (const latency_hist_t *hist, uint32_t count, uint32_t per_mille) {
+  uint32_t rank, sum, i, val;
+
+  rank = (uint32_t)((((uint64_t)count * per_mille) + 999U) / 1000U);
+  if (rank == 0U) {
+    rank = 1U;
+  }
+  sum = 0U;
+  for (i = 0U; i < LATENCY_HIST_BUCKETS; i++) {
+    sum += hist->bucket[i];
+    if (sum >= rank) {
+      break;
+    }
+  }
+  val = latency_bucket_max(i);
+  if (val > hist->max) {
+    val = hist->max;
+  }
+  if (val < hist->min) {
+    val = hist->min;
+  }
+  return val;
+}
+
+/* Print cycles in milliseconds with three decimals (8 character column, integer formatting) */
+static void latency_print_ms (uint32_t cycles) {
+  uint32_t us = cycles / (CPU_FREQ_HZ / 1000000U);
+
+  printf(" %4u.%03u", (unsigned int)(us / 1000U), (unsigned int)(us % 1000U));
+}
+
+void latency_hist_add (latency_stage_t stage, uint32_t cycles) {
+  latency_hist_t *hist = &latency_hist[stage];
+  uint32_t generation  = latency_generation;
+
+  if ((hist->generation != generation) || (hist->count == 0U)) {
+    memset(hist, 0, sizeof(latency_hist_t));
+    hist->generation = generation;
+    hist->min        = UINT32_MAX;
+  }
+  if (hist->count == UINT32_MAX) {
+    return;
+  }
+  if (cycles < hist->min) {
+    hist->min = cycles;
+  }
+  if (cycles > hist->max) {
+    hist->max = cycles;
+  }
+  hist->bucket[latency_bucket(cycles)]++;
+  hist->count++;
+}
+
+void latency_hist_print (void) {
+  const latency_hist_t *hist;
+  uint32_t stage, count;
+
+  printf("Latency [ms]        count      min      p50      p95      p99      max\n");
+  for (stage = 0U; stage < LATENCY_NUM_STAGES; stage++) {
+    hist  = &latency_hist[stage];
+    count = hist->count;
+    if ((hist->generation != latency_generation) || (count == 0U)) {
+      printf("%-15s %9u\n", latency_stage_names[stage], 0U);
+      continue;
+    }
+    printf("%-15s %9u", latency_stage_names[stage], (unsigned int)count);
+    latency_print_ms(hist->min);
+    latency_print_ms(latency_percentile(hist, count, 500U));
+    latency_print_ms(latency_percentile(hist, count, 950U));
+    latency_print_ms(latency_percentile(hist, count, 990U));
+    latency_print_ms(hist->max);
+    printf("\n");
+  }
+}
+
+void latency_hist_reset (void) {
+  latency_generation = latency_generation + 1U;
+}
+
+#else
+
+void latency_hist_add (latency_stage_t stage, uint32_t cycles) {
+  (void)stage;
+  (void)cycles;
+}
+
+void latency_hist_print (void) {
+  printf("Latency histograms not available, set ENABLE_TIME_PROFILING\n");
+}
+
+void latency_hist_reset (void) {
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef LATENCY_HIST_H__
+#define LATENCY_HIST_H__
+
+#include <stdint.h>
+
+/* Sub-buckets per power of two as a number of bits, the relative bucket width is 1 / 2^LATENCY_HIST_SUB_BITS */
+#ifndef LATENCY_HIST_SUB_BITS
+#define LATENCY_HIST_SUB_BITS   3U
+#endif
+
+/* Number of buckets of a histogram of 32-bit cycle counts */
+#define LATENCY_HIST_BUCKETS    ((33U - LATENCY_HIST_SUB_BITS) << LATENCY_HIST_SUB_BITS)
+
+/* Pipeline stages with a latency histogram, measured at the ENABLE_TIME_PROFILING points */
+typedef enum {
+  LATENCY_CAPTURE = 0,
+  LATENCY_PRE_PROCESS,
+  LATENCY_INFERENCE,
+  LATENCY_POST_PROCESS,
+  LATENCY_DISPLAY,
+  LATENCY_TOTAL,
+  LATENCY_NUM_STAGES
+} latency_stage_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add a latency sample to the histogram of a stage.
+ *
+ * Each stage is updated by a single thread; no locking is used.
+ *
+ * @param[in] stage   Pipeline stage.
+ * @param[in] cycles  Latency in CPU cycles.
+ */
+void latency_hist_add(latency_stage_t stage, uint32_t cycles);
+
+/**
+ * @brief Print count, minimum, p50, p95, p99 and maximum latency of all stages.
+ *
+ * Percentiles are reported as the upper bound of their bucket.
+ * May be called from any thread.
+ */
+void latency_hist_print(void);
+
+/**
+ * @brief Clear the histograms of all stages.
+ *
+ * May be called from any thread: each histogram is cleared by its updating
+ * thread on the next sample, until then it is reported as empty.
+ */
+void latency_hist_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LATENCY_HIST_H__ */
@@ -0,0 +1,215 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Formatting of binary log records.
+
+  The hot path only stores a format id and raw argument words. This file
+  turns them back into text, on the target in the low-priority log thread or
+  on a host computer in the log decoder. Each conversion of the format is
+  passed to snprintf on its own, with the argument word converted to the
+  type of that conversion. Fixed-point conversions (f, M) are split into
+  integer and fraction first, so no floating-point printf support is needed.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "log_format.h"
+
+#define LOG_FORMAT_STRING(id, format)   format,
+
+const char *const log_formats[LOG_ID_COUNT] = {
+  LOG_FORMAT_LIST(LOG_FORMAT_STRING)
+};
+
+/* Longest conversion specification, e.g. "%-12.3f" */
+#define SPEC_SIZE   16
+
+/* Largest fixed-point precision and integer part */
+#define FIXED_PREC_MAX    9U
+#define FIXED_INT_MAX     4000000000.0
+
+/* Flags, width and precision of a fixed-point conversion */
+typedef struct {
+  int      left;                        /* '-' flag */
+  int      width;                       /* Minimum field width */
+  uint32_t prec;                        /* Digits after the decimal point */
+} fixed_spec_t;
+
+static const uint32_t fixed_pow10[FIXED_PREC_MAX + 1U] = {
+  1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+/* Float stored in an argument word */
+static float word_to_float(uint32_t word) {
+  float f;
+
+  memcpy(&f, &word, sizeof(f));
+  return f;
+}
+
+/* Parse a conversion specification such as "%-12.3f" (precision defaults to 6) */
+static void fixed_spec_parse(const char *spec, fixed_spec_t *fs) {
+  const char *p = spec + 1;
+
+  fs->left  = 0;
+  fs->width = 0;
+  fs->prec  = 6U;
+
+  while ((*p != '\0') && (strchr("-+ #0", *p) != NULL)) {
+    if (*p == '-') {
+      fs->left = 1;
+    }
+    p++;
+  }
+  while ((*p >= '0') && (*p <= '9')) {
+    fs->width = (fs->width * 10) + (*p++ - '0');
+  }
+  if (*p == '.') {
+    fs->prec = 0U;
+    p++;
+    while ((*p >= '0') && (*p <= '9')) {
+      fs->prec = (fs->prec * 10U) + (uint32_t)(*p++ - '0');
+    }
+  }
+  if (fs->prec > FIXED_PREC_MAX) {
+    fs->prec = FIXED_PREC_MAX;
+  }
+}
+
+/* Format a value scaled by 10^prec as integer and fraction */
+static int fixed_format(char *buf, size_t size, const fixed_spec_t *fs, int negative, uint64_t scaled) {
+  char     num[32];
+  uint32_t scale = fixed_pow10[fs->prec];
+
+  if (fs->prec == 0U) {
+    snprintf(num, sizeof(num), "%s%lu", negative ? "-" : "", (unsigned long)(scaled / scale));
+  } else {
+    snprintf(num, sizeof(num), "%s%lu.%0*lu", negative ? "-" : "", (unsigned long)(scaled / scale),
+             (int)fs->prec, (unsigned long)(scaled % scale));
+  }
+  return snprintf(buf, size, fs->left ? "%-*s" : "%*s", fs->width, num);
+}
+
+size_t log_format_record(char *buf, size_t size, uint32_t id, const uint32_t *args, uint32_t argc) {
+  const char *fmt;
+  size_t      len = 0U;
+  uint32_t    arg = 0U;
+
+  if (id >= LOG_ID_COUNT) {
+    int n = snprintf(buf, size, "<log %u>\n", (unsigned int)id);
+    return ((n < 0) || ((size_t)n >= size)) ? (size - 1U) : (size_t)n;
+  }
+
+  for (fmt = log_formats[id]; (*fmt != '\0') && (len < (size - 1U)); ) {
+    char         spec[SPEC_SIZE + 1];
+    char         str[(LOG_STR_WORDS * 4U) + 1U];
+    const char  *end = fmt + 1;
+    size_t       spec_len;
+    fixed_spec_t fs;
+    double       value;
+    int          negative;
+    int          n;
+
+    if (*fmt != '%') {
+      buf[len++] = *fmt++;
+      continue;
+    }
+
+    /* Flags, width and precision, then the conversion character */
+    while ((*end != '\0') && (strchr("-+ #0123456789.", *end) != NULL)) {
+      end++;
+    }
+    spec_len = (size_t)(end - fmt) + 1U;
+    if ((*end == '\0') || (spec_len > SPEC_SIZE)) {
+      buf[len++] = *fmt++;
+      continue;
+    }
+    memcpy(spec, fmt, spec_len);
+    spec[spec_len] = '\0';
+    fmt = end + 1;
+
+    if (*end == '%') {
+      buf[len++] = '%';
+      continue;
+    }
+    if (arg + ((*end == 's') ? LOG_STR_WORDS : 1U) > argc) {
+      /* Record holds fewer arguments than the format needs */
+      buf[len++] = '?';
+      continue;
+    }
+
+    switch (*end) {
+      case 'd':
+      case 'i':
+        n = snprintf(&buf[len], size - len, spec, (int)(int32_t)args[arg++]);
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'c':
+        n = snprintf(&buf[len], size - len, spec, (unsigned int)args[arg++]);
+        break;
+      case 'f':
+        fixed_spec_parse(spec, &fs);
+        value = (double)word_to_float(args[arg++]);
+        negative = (value < 0.0);
+        if (negative) {
+          value = -value;
+        }
+        if (!(value < FIXED_INT_MAX)) {
+          /* Out of range or not a number */
+          value = FIXED_INT_MAX;
+        }
+        n = fixed_format(&buf[len], size - len, &fs, negative,
+                         (uint64_t)((value * (double)fixed_pow10[fs.prec]) + 0.5));
+        break;
+      case 'M':
+        fixed_spec_parse(spec, &fs);
+        n = fixed_format(&buf[len], size - len, &fs, 0,
+                         (((uint64_t)args[arg++] * fixed_pow10[fs.prec]) + ((LOG_CPU_FREQ_HZ / 1000U) / 2U)) /
+                         (LOG_CPU_FREQ_HZ / 1000U));
+        break;
+      case 's':
+        /* Little-endian characters, zero padded */
+        for (uint32_t i = 0U; i < (LOG_STR_WORDS * 4U); i++) {
+          str[i] = (char)(args[arg + (i / 4U)] >> (8U * (i % 4U)));
+        }
+        str[LOG_STR_WORDS * 4U] = '\0';
+        arg += LOG_STR_WORDS;
+        n = snprintf(&buf[len], size - len, spec, str);
+        break;
+      default:
+        /* Unsupported conversion, copied as text */
+        n = snprintf(&buf[len], size - len, "%s", spec);
+        break;
+    }
+
+    if (n > 0) {
+      len += (size_t)n;
+      if (len > (size - 1U)) {
+        len = size - 1U;
+      }
+    }
+  }
+
+  buf[len] = '\0';
+  return len;
+}
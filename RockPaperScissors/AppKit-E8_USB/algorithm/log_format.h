@@ -0,0 +1,100 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef LOG_FORMAT_H__
+#define LOG_FORMAT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* First byte of a log record (low byte of the header word), never part of ASCII text */
+#define LOG_RECORD_MAGIC    0xB7U
+
+/* Log record header word: magic, number of argument words, format id */
+#define LOG_RECORD_HEADER(id, argc)   (LOG_RECORD_MAGIC | ((uint32_t)(argc) << 8) | ((uint32_t)(id) << 16))
+#define LOG_RECORD_ARGC(header)       (((header) >> 8) & 0xFFU)
+#define LOG_RECORD_ID(header)         ((header) >> 16)
+
+/* Header and timestamp words in front of the argument words */
+#define LOG_RECORD_HEAD_WORDS         2U
+
+/* Argument words of a %s argument, strings are truncated to 4 * LOG_STR_WORDS characters */
+#define LOG_STR_WORDS       4U
+
+/* CPU clock of the cycle counts logged with %M and of the record timestamps */
+#ifndef LOG_CPU_FREQ_HZ
+#define LOG_CPU_FREQ_HZ     400000000UL
+#endif
+
+/*
+  Log formats, shared by the target and the host decoder.
+
+  One argument word is stored per conversion, except for %s (LOG_STR_WORDS
+  words). Conversions: d, i (int32_t), u, x, X, c (uint32_t), f (float),
+  s (string) and M (uint32_t cycle count, printed in milliseconds like %f).
+  f and M are formatted with integer arithmetic (flags '-', width and
+  precision up to 9), so the target needs no floating-point printf. Append
+  new formats at the end to keep recorded ids valid.
+*/
+#define LOG_FORMAT_LIST(X)                                                                  \
+  X(LOG_CAPTURE_TIME,       "Capture time: %3.3M ms.\n")                                    \
+  X(LOG_PRE_PROCESS_TIME,   "Pre Processing time: %3.3M ms.\n")                             \
+  X(LOG_INFERENCE_TIME,     "Inference time: %3.3M ms.\n")                                  \
+  X(LOG_POST_PROCESS_TIME,  "Post Process time: %3.3M ms.\n")                               \
+  X(LOG_DISPLAY_TIME,       "Display time: %3.3M ms.\n")                                    \
+  X(LOG_TOTAL_TIME,         "Total usecase time: %3.3M ms.\n")                              \
+  X(LOG_DISPLAY_FRAMES,     "Display frames presented: %u, skipped: %u\n")                  \
+  X(LOG_MOTION_GATE_FRAMES, "Motion gate frames inferred: %u, gated: %u\n")                 \
+  X(LOG_PREDICTION,         "\nPost-processed output:\nPredicted class : %s%s\033[0m\n"      \
+                            "Confidence      : %.2f %%\n")                                  \
+  X(LOG_CAPTURE_DROPPED,    "Dropped camera frames: %u\n")
+
+#define LOG_FORMAT_ID(id, format)     id,
+
+/// Log format ids
+typedef enum {
+  LOG_FORMAT_LIST(LOG_FORMAT_ID)
+  LOG_ID_COUNT
+} log_id_t;
+
+#undef LOG_FORMAT_ID
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Format strings, indexed by log_id_t */
+extern const char *const log_formats[LOG_ID_COUNT];
+
+/**
+ * @brief Format the arguments of a log record as text.
+ *
+ * @param[out] buf   Text buffer, always null-terminated.
+ * @param[in]  size  Size of the text buffer in bytes (at least 1).
+ * @param[in]  id    Format id.
+ * @param[in]  args  Argument words.
+ * @param[in]  argc  Number of argument words.
+ * @return Length of the text in buf.
+ */
+size_t log_format_record(char *buf, size_t size, uint32_t id, const uint32_t *args, uint32_t argc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_FORMAT_H__ */
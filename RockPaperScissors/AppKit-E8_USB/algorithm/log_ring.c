@@ -0,0 +1,179 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Deferred logging.
+
+  Producers on the hot path reserve space in a ring of 32-bit words with an
+  exclusive load/store on the head index, copy the record (header, cycle
+  counter timestamp and raw argument words) and publish it by writing the
+  header word last. A low-priority thread drains the ring, formats the
+  records with log_format_record() and prints the text, or with
+  LOG_RING_BINARY writes the records unchanged for log_decode on the host.
+  Consumed words are cleared, so a zero header marks a record that is still
+  being written.
+*/
+
+#include <stdio.h>
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#include "cmsis_os2.h"
+
+#include "log_ring.h"
+#include "profiler.h"
+
+#define LOG_RING_MASK   (LOG_RING_SIZE - 1U)
+
+#if LOG_DEFERRED
+
+/* Log thread attributes */
+static const osThreadAttr_t attrLogThread = {
+  .name       = "Log",
+  .stack_size = 2048U,
+  .priority   = osPriorityLow
+};
+
+static uint32_t          log_ring[LOG_RING_SIZE];
+static volatile uint32_t log_head;      /* Words reserved by producers */
+static volatile uint32_t log_tail;      /* Words released by the log thread */
+static volatile uint32_t log_drops;
+
+/* Atomically add to a counter */
+static void atomic_add(volatile uint32_t *cnt, uint32_t val) {
+  uint32_t v;
+
+  do {
+    v = __LDREXW(cnt);
+  } while (__STREXW(v + val, cnt) != 0U);
+}
+
+void log_ring_write(uint32_t id, const uint32_t *args, uint32_t argc) {
+  const uint32_t words = LOG_RECORD_HEAD_WORDS + argc;
+  uint32_t       head;
+
+  /* Reserve space */
+  do {
+    head = __LDREXW(&log_head);
+    if ((head - log_tail) + words > LOG_RING_SIZE) {
+      __CLREX();
+      atomic_add(&log_drops, 1U);
+      return;
+    }
+  } while (__STREXW(head + words, &log_head) != 0U);
+
+  log_ring[(head + 1U) & LOG_RING_MASK] = profiler_start();
+  for (uint32_t i = 0U; i < argc; i++) {
+    log_ring[(head + LOG_RECORD_HEAD_WORDS + i) & LOG_RING_MASK] = args[i];
+  }
+
+  /* Publish the record */
+  __DMB();
+  log_ring[head & LOG_RING_MASK] = LOG_RECORD_HEADER(id, argc);
+}
+
+uint32_t log_ring_dropped(void) {
+  return log_drops;
+}
+
+/* Copy the next complete record out of the ring, returns its size in words or 0 if there is none */
+static uint32_t log_ring_read(uint32_t *record) {
+  const uint32_t tail = log_tail;
+  uint32_t       words;
+
+  if (tail == log_head) {
+    return 0U;
+  }
+  record[0] = log_ring[tail & LOG_RING_MASK];
+  if (record[0] == 0U) {
+    /* Reserved but not yet published */
+    return 0U;
+  }
+  __DMB();
+
+  words = LOG_RECORD_HEAD_WORDS + LOG_RECORD_ARGC(record[0]);
+  log_ring[tail & LOG_RING_MASK] = 0U;
+  for (uint32_t i = 1U; i < words; i++) {
+    record[i] = log_ring[(tail + i) & LOG_RING_MASK];
+    log_ring[(tail + i) & LOG_RING_MASK] = 0U;
+  }
+
+  /* Release the space after it was cleared */
+  __DMB();
+  log_tail = tail + words;
+
+  return words;
+}
+
+// Log Thread function
+static __NO_RETURN void LogThread (void *argument) {
+  static uint32_t record[LOG_RECORD_HEAD_WORDS + 255U];
+#if !LOG_RING_BINARY
+  static char     text[LOG_TEXT_SIZE];
+#endif
+  uint32_t        drops_reported = 0U;
+  uint32_t        drops;
+  uint32_t        words;
+  (void)argument;
+
+  for (;;) {
+    while ((words = log_ring_read(record)) != 0U) {
+#if LOG_RING_BINARY
+      fwrite(record, sizeof(uint32_t), words, stdout);
+#else
+      log_format_record(text, sizeof(text), LOG_RECORD_ID(record[0]),
+                        &record[LOG_RECORD_HEAD_WORDS], words - LOG_RECORD_HEAD_WORDS);
+      fputs(text, stdout);
+#endif
+    }
+
+    drops = log_drops;
+    if (drops != drops_reported) {
+      printf("Log ring full, %u messages dropped\n", (unsigned int)(drops - drops_reported));
+      drops_reported = drops;
+    }
+
+    osDelay(LOG_DRAIN_INTERVAL);
+  }
+}
+
+int32_t log_ring_init(void) {
+  if (osThreadNew(LogThread, NULL, &attrLogThread) == NULL) {
+    return -1;
+  }
+  return 0;
+}
+
+#else
+
+void log_ring_write(uint32_t id, const uint32_t *args, uint32_t argc) {
+  char text[LOG_TEXT_SIZE];
+
+  log_format_record(text, sizeof(text), id, args, argc);
+  fputs(text, stdout);
+}
+
+uint32_t log_ring_dropped(void) {
+  return 0U;
+}
+
+int32_t log_ring_init(void) {
+  return 0;
+}
+
+#endif
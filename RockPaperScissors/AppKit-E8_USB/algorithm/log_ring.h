@@ -0,0 +1,135 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef LOG_RING_H__
+#define LOG_RING_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include "log_format.h"
+
+/* Defer formatting of log messages to the low-priority log thread (0: format and print in place) */
+#ifndef LOG_DEFERRED
+#define LOG_DEFERRED        1
+#endif
+
+/* Log ring size in 32-bit words, power of two */
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE       1024U
+#endif
+
+/* Write the binary records to STDOUT instead of text, decoded on the host with log_decode */
+#ifndef LOG_RING_BINARY
+#define LOG_RING_BINARY     0
+#endif
+
+/* Interval in ms at which the log thread drains the ring */
+#ifndef LOG_DRAIN_INTERVAL
+#define LOG_DRAIN_INTERVAL  10U
+#endif
+
+/* Size of the text of one formatted log message */
+#ifndef LOG_TEXT_SIZE
+#define LOG_TEXT_SIZE       160U
+#endif
+
+#if (LOG_RING_SIZE & (LOG_RING_SIZE - 1U)) != 0U
+#error "LOG_RING_SIZE must be a power of two"
+#endif
+
+/* Argument words of LOG_MSG */
+#define LOG_U(x)    ((uint32_t)(x))
+#define LOG_D(x)    ((uint32_t)(int32_t)(x))
+#define LOG_F(x)    log_arg_float((float)(x))
+#define LOG_S(s)    log_arg_str((s), 0U), log_arg_str((s), 1U), log_arg_str((s), 2U), log_arg_str((s), 3U)
+
+/* Characters of a LOG_S string argument, longer strings are truncated */
+#define LOG_STR_MAX 16U
+
+/**
+ * @brief Log a message with a format id and its argument words.
+ *
+ * Example: LOG_MSG(LOG_INFERENCE_TIME, LOG_U(cycles));
+ */
+#define LOG_MSG(id, ...)                                                                  \
+  do {                                                                                    \
+    const uint32_t log_args_[] = { 0U, ##__VA_ARGS__ };                                   \
+    log_ring_write((uint32_t)(id), &log_args_[1],                                         \
+                   (uint32_t)(sizeof(log_args_) / sizeof(log_args_[0])) - 1U);            \
+  } while (0)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Float argument word */
+static inline uint32_t log_arg_float(float f) {
+  uint32_t word;
+
+  memcpy(&word, &f, sizeof(word));
+  return word;
+}
+
+/* Argument word of a string, four characters per word (little-endian, zero padded) */
+static inline uint32_t log_arg_str(const char *s, uint32_t word) {
+  uint8_t  chars[4] = { 0U, 0U, 0U, 0U };
+  uint32_t len      = (uint32_t)strnlen(s, LOG_STR_MAX);
+  uint32_t pos      = word * 4U;
+
+  /* Copy only from within the string, the rest of the word stays zero */
+  if (pos > len) {
+    pos = len;
+  }
+  memcpy(chars, &s[pos], ((len - pos) < 4U) ? (len - pos) : 4U);
+  return (uint32_t)chars[0] | ((uint32_t)chars[1] << 8U) |
+         ((uint32_t)chars[2] << 16U) | ((uint32_t)chars[3] << 24U);
+}
+
+/**
+ * @brief Create the log thread which drains the log ring.
+ *
+ * Messages written before the thread is created are kept in the ring.
+ *
+ * @return 0 on success, -1 on error.
+ */
+int32_t log_ring_init(void);
+
+/**
+ * @brief Write a log record to the log ring.
+ *
+ * Copies the format id, a cycle counter timestamp and the argument words.
+ * Lock-free and safe to call from several threads; when the ring is full
+ * the record is dropped and counted.
+ *
+ * @param[in] id    Format id (log_id_t).
+ * @param[in] args  Argument words.
+ * @param[in] argc  Number of argument words (at most 255).
+ */
+void log_ring_write(uint32_t id, const uint32_t *args, uint32_t argc);
+
+/**
+ * @brief Get the number of records dropped because the log ring was full.
+ */
+uint32_t log_ring_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_RING_H__ */
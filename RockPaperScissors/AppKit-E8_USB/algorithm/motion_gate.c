@@ -0,0 +1,114 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Motion gate.
+
+  Frames of a static scene give the same classification, so inference can be
+  skipped for them. Each frame is reduced to a coarse luma signature (one mean
+  luma value per cell, from a sparse set of samples) and compared with the
+  signature of the last frame that was passed on to inference. Comparing
+  with the last inferred frame instead of the previous frame makes slow
+  changes (lighting drift, slow movement) add up until they pass the gate.
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "motion_gate.h"
+
+/* Luma samples per cell */
+#define CELL_SAMPLES    ((MOTION_GATE_CELL_SIZE / MOTION_GATE_SAMPLE_STEP) * \
+                         (MOTION_GATE_CELL_SIZE / MOTION_GATE_SAMPLE_STEP))
+
+#if ((MOTION_GATE_CELL_SIZE % MOTION_GATE_SAMPLE_STEP) != 0)
+#error "MOTION_GATE_CELL_SIZE must be a multiple of MOTION_GATE_SAMPLE_STEP."
+#endif
+
+uint32_t motion_gate_frames_gated    = 0U;
+uint32_t motion_gate_frames_inferred = 0U;
+
+/* Luma signature of the reference frame and of the checked frame */
+static uint8_t  signature_ref[MOTION_GATE_MAX_CELLS];
+static uint8_t  signature_new[MOTION_GATE_MAX_CELLS];
+static int      signature_cells;        /* Cells of the reference frame, 0: no reference */
+static uint32_t gated_in_row;
+
+/* Mean luma of each cell, sampled every MOTION_GATE_SAMPLE_STEP pixels */
+static void compute_signature(const uint8_t *image, int width, int cols, int rows, uint8_t *signature) {
+  for (int cy = 0; cy < rows; ++cy) {
+    for (int cx = 0; cx < cols; ++cx) {
+      uint32_t sum = 0U;
+
+      for (int y = 0; y < MOTION_GATE_CELL_SIZE; y += MOTION_GATE_SAMPLE_STEP) {
+        const uint8_t *px = &image[(((cy * MOTION_GATE_CELL_SIZE) + y) * width +
+                                    (cx * MOTION_GATE_CELL_SIZE)) * 3];
+
+        for (int x = 0; x < MOTION_GATE_CELL_SIZE; x += MOTION_GATE_SAMPLE_STEP) {
+          /* BT.601 luma, 8-bit fixed point */
+          sum += ((77U * px[0]) + (150U * px[1]) + (29U * px[2])) >> 8;
+          px  += MOTION_GATE_SAMPLE_STEP * 3;
+        }
+      }
+      *signature++ = (uint8_t)(sum / CELL_SAMPLES);
+    }
+  }
+}
+
+void motion_gate_reset(void) {
+  signature_cells = 0;
+  gated_in_row    = 0U;
+}
+
+int motion_gate_check(const uint8_t *image, int width, int height) {
+  const int cols  = width  / MOTION_GATE_CELL_SIZE;
+  const int rows  = height / MOTION_GATE_CELL_SIZE;
+  const int cells = cols * rows;
+  int       changed = 0;
+
+  if ((cells <= 0) || (cells > MOTION_GATE_MAX_CELLS)) {
+    motion_gate_frames_inferred++;
+    return 0;
+  }
+
+  compute_signature(image, width, cols, rows, signature_new);
+
+  if ((cells == signature_cells) && (gated_in_row < ML_MOTION_GATE_MAX_REUSE)) {
+    for (int i = 0; i < cells; ++i) {
+      if (abs((int)signature_new[i] - (int)signature_ref[i]) > ML_MOTION_GATE_THRESHOLD) {
+        if (++changed > ML_MOTION_GATE_MAX_CHANGED) {
+          break;
+        }
+      }
+    }
+    if (changed <= ML_MOTION_GATE_MAX_CHANGED) {
+      gated_in_row++;
+      motion_gate_frames_gated++;
+      return 1;
+    }
+  }
+
+  /* Frame passed on to inference becomes the reference */
+  for (int i = 0; i < cells; ++i) {
+    signature_ref[i] = signature_new[i];
+  }
+  signature_cells = cells;
+  gated_in_row    = 0U;
+  motion_gate_frames_inferred++;
+  return 0;
+}
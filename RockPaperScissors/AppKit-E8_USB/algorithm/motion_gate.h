@@ -0,0 +1,80 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef MOTION_GATE_H__
+#define MOTION_GATE_H__
+
+#include <stdint.h>
+
+#include "config_ml_model.h"
+
+/* Cell size in pixels, the luma signature holds the mean luma of each cell */
+#ifndef MOTION_GATE_CELL_SIZE
+#define MOTION_GATE_CELL_SIZE       8
+#endif
+
+/* Distance between luma samples within a cell, in pixels */
+#ifndef MOTION_GATE_SAMPLE_STEP
+#define MOTION_GATE_SAMPLE_STEP     2
+#endif
+
+/* Number of cells of the largest image (ML image) */
+#define MOTION_GATE_MAX_CELLS       ((ML_IMAGE_WIDTH  / MOTION_GATE_CELL_SIZE) * \
+                                     (ML_IMAGE_HEIGHT / MOTION_GATE_CELL_SIZE))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Frames for which the previous result was reused, and frames passed on to inference */
+extern uint32_t motion_gate_frames_gated;
+extern uint32_t motion_gate_frames_inferred;
+
+/**
+ * @brief Reset the motion gate.
+ *
+ * Drops the reference frame, so the next frame is passed on to inference.
+ * Call it when the result of the last passed frame is not available (for
+ * example when its inference failed).
+ */
+void motion_gate_reset(void);
+
+/**
+ * @brief Check whether a frame differs from the last inferred frame.
+ *
+ * Computes the luma signature of the frame (mean luma of each
+ * MOTION_GATE_CELL_SIZE cell, sampled every MOTION_GATE_SAMPLE_STEP pixels)
+ * and compares it with the signature of the reference frame. The frame is
+ * gated when at most ML_MOTION_GATE_MAX_CHANGED cells differ by more than
+ * ML_MOTION_GATE_THRESHOLD luma levels and fewer than
+ * ML_MOTION_GATE_MAX_REUSE frames were gated in a row. Otherwise the frame
+ * becomes the new reference frame.
+ *
+ * @param[in] image   Pointer to the frame (RGB888).
+ * @param[in] width   Frame width in pixels.
+ * @param[in] height  Frame height in pixels.
+ * @return 1 when the frame is gated and the previous result may be reused,
+ *         0 when the frame must be passed on to inference.
+ */
+int motion_gate_check(const uint8_t *image, int width, int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MOTION_GATE_H__ */
@@ -0,0 +1,146 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Ethos-U PMU sampling.
+
+  Overrides the weak inference begin/end callbacks of the Ethos-U driver:
+  at the start of every NPU job the event counters are programmed with
+  NPU_PMU_EVENTn and reset together with the cycle counter, and when the
+  job is collected (ethosu_wait) the counters are read back into a sample.
+  Both callbacks run in the thread invoking the NPU, so no locking is used.
+*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "ethosu_driver.h"
+#include "npu_pmu.h"
+
+static npu_pmu_sample_t npu_pmu_samples[NPU_PMU_MAX_JOBS];
+static uint32_t         npu_pmu_samples_num;
+
+#if NPU_PMU_ENABLE
+
+/* Event counters in use */
+#define NPU_PMU_CNT_MASK    ((1UL << NPU_PMU_NUM_EVENTS) - 1UL)
+
+static const enum ethosu_pmu_event_type npu_pmu_events[NPU_PMU_NUM_EVENTS] = {
+  NPU_PMU_EVENT0,
+  NPU_PMU_EVENT1,
+  NPU_PMU_EVENT2,
+  NPU_PMU_EVENT3,
+#if (NPU_PMU_NUM_EVENTS > 4)
+  NPU_PMU_EVENT4,
+  NPU_PMU_EVENT5,
+  NPU_PMU_EVENT6,
+  NPU_PMU_EVENT7,
+#endif
+};
+
+/* Ethos-U driver callback: NPU job is about to start */
+void ethosu_inference_begin (struct ethosu_driver *drv, void *user_arg) {
+  uint32_t i;
+  (void)user_arg;
+
+  ETHOSU_PMU_Enable(drv);
+  for (i = 0U; i < NPU_PMU_NUM_EVENTS; i++) {
+    ETHOSU_PMU_Set_EVTYPER(drv, i, npu_pmu_events[i]);
+  }
+  ETHOSU_PMU_CYCCNT_Reset(drv);
+  ETHOSU_PMU_EVCNTR_ALL_Reset(drv);
+  ETHOSU_PMU_Set_CNTR_OVS(drv, NPU_PMU_CNT_MASK | ETHOSU_PMU_CCNT_Msk);
+  ETHOSU_PMU_CNTR_Enable(drv, NPU_PMU_CNT_MASK | ETHOSU_PMU_CCNT_Msk);
+}
+
+/* Ethos-U driver callback: NPU job has finished or timed out */
+void ethosu_inference_end (struct ethosu_driver *drv, void *user_arg) {
+  npu_pmu_sample_t *sample;
+  uint64_t cycles;
+  uint32_t i;
+  (void)user_arg;
+
+  ETHOSU_PMU_CNTR_Disable(drv, NPU_PMU_CNT_MASK | ETHOSU_PMU_CCNT_Msk);
+
+  /* Jobs beyond NPU_PMU_MAX_JOBS are added to the last sample */
+  if (npu_pmu_samples_num < NPU_PMU_MAX_JOBS) {
+    sample = &npu_pmu_samples[npu_pmu_samples_num++];
+    memset(sample, 0, sizeof(npu_pmu_sample_t));
+  } else {
+    sample = &npu_pmu_samples[NPU_PMU_MAX_JOBS - 1U];
+  }
+
+  cycles = ETHOSU_PMU_Get_CCNTR(drv) + sample->cycles;
+  if (cycles > UINT32_MAX) {
+    cycles = UINT32_MAX;
+    sample->overflow |= ETHOSU_PMU_CCNT_Msk;
+  }
+  sample->cycles = (uint32_t)cycles;
+  for (i = 0U; i < NPU_PMU_NUM_EVENTS; i++) {
+    sample->events[i] += ETHOSU_PMU_Get_EVCNTR(drv, i);
+  }
+  sample->overflow |= ETHOSU_PMU_Get_CNTR_OVS(drv) & (NPU_PMU_CNT_MASK | ETHOSU_PMU_CCNT_Msk);
+  sample->jobs++;
+
+  ETHOSU_PMU_Disable(drv);
+}
+
+#endif
+
+/* Discard the samples of the previous inference */
+void npu_pmu_reset (void) {
+  npu_pmu_samples_num = 0U;
+}
+
+/* Get the number of samples taken since npu_pmu_reset() */
+uint32_t npu_pmu_num_samples (void) {
+  return npu_pmu_samples_num;
+}
+
+/* Get a sample taken since npu_pmu_reset() */
+const npu_pmu_sample_t *npu_pmu_get_sample (uint32_t index) {
+  if (index >= npu_pmu_samples_num) {
+    return NULL;
+  }
+  return &npu_pmu_samples[index];
+}
+
+/* Sum up the samples taken since npu_pmu_reset() and discard them */
+uint32_t npu_pmu_read (npu_pmu_sample_t *total) {
+  uint32_t n, i;
+
+  memset(total, 0, sizeof(npu_pmu_sample_t));
+  for (n = 0U; n < npu_pmu_samples_num; n++) {
+    const npu_pmu_sample_t *sample = &npu_pmu_samples[n];
+
+    total->jobs     += sample->jobs;
+    total->overflow |= sample->overflow;
+    if (total->cycles > (UINT32_MAX - sample->cycles)) {
+      total->cycles    = UINT32_MAX;
+      total->overflow |= ETHOSU_PMU_CCNT_Msk;
+    } else {
+      total->cycles   += sample->cycles;
+    }
+    for (i = 0U; i < NPU_PMU_NUM_EVENTS; i++) {
+      total->events[i] += sample->events[i];
+    }
+  }
+  npu_pmu_samples_num = 0U;
+
+  return total->jobs;
+}
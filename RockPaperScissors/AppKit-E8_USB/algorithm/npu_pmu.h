@@ -0,0 +1,131 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef NPU_PMU_H__
+#define NPU_PMU_H__
+
+#include <stdint.h>
+
+#include "pmu_ethosu.h"
+
+/* Sample the Ethos-U PMU counters of every NPU job (0: disabled) */
+#ifndef NPU_PMU_ENABLE
+#define NPU_PMU_ENABLE      0
+#endif
+
+/* Record the PMU counters of each inference to the SDS stream "NPU_PMU" (NPU_PMU.sds.yml) */
+#ifndef NPU_PMU_SDS
+#define NPU_PMU_SDS         1
+#endif
+
+/* Number of NPU jobs of one inference sampled separately, further jobs are added to the last sample */
+#ifndef NPU_PMU_MAX_JOBS
+#define NPU_PMU_MAX_JOBS    4U
+#endif
+
+/* Events counted by the PMU event counters (enum ethosu_pmu_event_type) */
+#ifdef ETHOSU85
+#ifndef NPU_PMU_EVENT0
+#define NPU_PMU_EVENT0      ETHOSU_PMU_NPU_ACTIVE
+#endif
+#ifndef NPU_PMU_EVENT1
+#define NPU_PMU_EVENT1      ETHOSU_PMU_NPU_IDLE
+#endif
+#ifndef NPU_PMU_EVENT2
+#define NPU_PMU_EVENT2      ETHOSU_PMU_MAC_ACTIVE
+#endif
+#ifndef NPU_PMU_EVENT3
+#define NPU_PMU_EVENT3      ETHOSU_PMU_EXT_RD_DATA_BEAT_RECEIVED
+#endif
+#ifndef NPU_PMU_EVENT4
+#define NPU_PMU_EVENT4      ETHOSU_PMU_EXT_WR_DATA_BEAT_WRITTEN
+#endif
+#ifndef NPU_PMU_EVENT5
+#define NPU_PMU_EVENT5      ETHOSU_PMU_EXT_RD_TRAN_REQ_STALLED
+#endif
+#ifndef NPU_PMU_EVENT6
+#define NPU_PMU_EVENT6      ETHOSU_PMU_SRAM_RD_DATA_BEAT_RECEIVED
+#endif
+#ifndef NPU_PMU_EVENT7
+#define NPU_PMU_EVENT7      ETHOSU_PMU_SRAM_WR_DATA_BEAT_WRITTEN
+#endif
+#else
+#ifndef NPU_PMU_EVENT0
+#define NPU_PMU_EVENT0      ETHOSU_PMU_NPU_ACTIVE
+#endif
+#ifndef NPU_PMU_EVENT1
+#define NPU_PMU_EVENT1      ETHOSU_PMU_AXI0_RD_DATA_BEAT_RECEIVED
+#endif
+#ifndef NPU_PMU_EVENT2
+#define NPU_PMU_EVENT2      ETHOSU_PMU_AXI0_WR_DATA_BEAT_WRITTEN
+#endif
+#ifndef NPU_PMU_EVENT3
+#define NPU_PMU_EVENT3      ETHOSU_PMU_AXI1_RD_DATA_BEAT_RECEIVED
+#endif
+#endif
+
+/* Number of event counters */
+#define NPU_PMU_NUM_EVENTS  ETHOSU_PMU_NCOUNTERS
+
+/* PMU counters of one NPU job, or summed up over several jobs */
+typedef struct {
+  uint32_t jobs;                        /* Number of NPU jobs */
+  uint32_t overflow;                    /* Overflowed counters (ETHOSU_PMU_CNTn_Msk, ETHOSU_PMU_CCNT_Msk) */
+  uint32_t cycles;                      /* NPU cycles from job start until the job was collected */
+  uint32_t events[NPU_PMU_NUM_EVENTS];  /* Event counts, NPU_PMU_EVENT0 onwards */
+} npu_pmu_sample_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Discard the samples of the previous inference.
+ *
+ * Call before starting an inference.
+ */
+void npu_pmu_reset(void);
+
+/**
+ * @brief Get the number of samples taken since npu_pmu_reset().
+ *
+ * @return Number of samples (at most NPU_PMU_MAX_JOBS).
+ */
+uint32_t npu_pmu_num_samples(void);
+
+/**
+ * @brief Get a sample taken since npu_pmu_reset(), in the order of the NPU jobs.
+ *
+ * @param[in] index  Sample index.
+ * @return Pointer to the sample, or NULL if index is out of range.
+ */
+const npu_pmu_sample_t *npu_pmu_get_sample(uint32_t index);
+
+/**
+ * @brief Sum up the samples taken since npu_pmu_reset() and discard them.
+ *
+ * @param[out] total  Counters of all NPU jobs.
+ * @return Number of NPU jobs, 0 if no job was sampled.
+ */
+uint32_t npu_pmu_read(npu_pmu_sample_t *total);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NPU_PMU_H__ */
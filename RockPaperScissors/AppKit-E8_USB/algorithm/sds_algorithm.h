@@ -44,6 +44,20 @@ extern int32_t InitAlgorithm (void);
 */
 extern int32_t ExecuteAlgorithm (uint8_t *in_buf, uint32_t in_num, uint8_t *out_buf, uint32_t out_num);
 
+/**
+  \fn           void SelectNextModel (void)
+  \brief        Request switching to the next loaded model.
+                The switch is applied by ExecuteAlgorithm before its next inference.
+*/
+extern void SelectNextModel (void);
+
+/**
+  \fn           void RequestETDump (void)
+  \brief        Request writing the profiling events recorded by the ExecuTorch event tracer as ETDump.
+                The ETDump is written by ExecuteAlgorithm before its next inference.
+*/
+extern void RequestETDump (void);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -28,7 +28,20 @@
 
 // Output Data block size, in bytes
 #ifndef SDS_ALGO_DATA_OUT_BLOCK_SIZE
+#if ML_OUT_TOPK
+#define SDS_ALGO_DATA_OUT_BLOCK_SIZE    (4 + (4 * ML_TOPK))
+#else
 #define SDS_ALGO_DATA_OUT_BLOCK_SIZE    (4 * sizeof(float))
 #endif
+#endif
+
+// Number of frame slots in flight between capture and algorithm execution
+// 1: capture and algorithm execution run serially in the Algorithm thread
+// 2 or more: a Capture thread fills free slots while the Algorithm thread
+//            executes the algorithm on filled slots (each slot holds one
+//            input and one output data block)
+#ifndef SDS_ALGO_FRAME_SLOTS
+#define SDS_ALGO_FRAME_SLOTS            2
+#endif
 
 #endif
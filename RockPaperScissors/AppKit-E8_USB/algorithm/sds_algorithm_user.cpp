@@ -20,8 +20,6 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
-#include <vector>
-#include <utility>
 
 #include "cmsis_vstream.h"
 #include "config_video.h"          /* DISPLAY_IMAGE_SIZE, DISPLAY_FRAME_BUF_ATTRIBUTE */
@@ -30,8 +28,13 @@
 #include "app_setup.h"
 #include "arm_executor_runner.h"
 #include "image_processing_func.h"
+#include "display_overlay.h"
+#include "motion_gate.h"
+#include "log_ring.h"
 #include "model_pte.h"
 #include "profiler.h"
+#include "timeline.h"
+#include "latency_hist.h"
 
 #include <executorch/extension/data_loader/buffer_data_loader.h>
 #include <executorch/runtime/executor/program.h>
@@ -45,21 +48,76 @@ using executorch::runtime::Result;
  * ============================================================================
  */
 
-/* Display frame buffer (RGB888) */
-static uint8_t LCD_Frame[DISPLAY_IMAGE_SIZE] DISPLAY_FRAME_BUF_ATTRIBUTE;
+/* Display frame buffer (RGB888), DISPLAY_FRAME_BLOCKS frames */
+static uint8_t LCD_Frame[DISPLAY_FRAME_BLOCKS * DISPLAY_IMAGE_SIZE] DISPLAY_FRAME_BUF_ATTRIBUTE;
 
-/* Runner state – must survive across ExecuteAlgorithm() calls */
+/* Display mode: single frame updates or flip between frame buffers on vertical sync */
+#if (DISPLAY_FRAME_BLOCKS > 1)
+#define DISPLAY_STREAM_MODE  VSTREAM_MODE_CONTINUOUS
+#else
+#define DISPLAY_STREAM_MODE  VSTREAM_MODE_SINGLE
+#endif
+
+#if (DISPLAY_FRAME_BLOCKS > DISPLAY_OVERLAY_MAX_FRAMES)
+#error "Overlay tracks fewer frame buffers than DISPLAY_FRAME_BLOCKS, check DISPLAY_OVERLAY_MAX_FRAMES definition."
+#endif
+
+/* ML image position in the display frame (centred) */
+#define DISPLAY_IMAGE_X     ((DISPLAY_FRAME_WIDTH  - IMAGE_WIDTH)  / 2)
+#define DISPLAY_IMAGE_Y     ((DISPLAY_FRAME_HEIGHT - IMAGE_HEIGHT) / 2)
+
+/* Overlay position: centred below the ML image as seen on the panel */
+#define DISPLAY_OVERLAY_GAP 8
+#define DISPLAY_OVERLAY_X   ((DISPLAY_FRAME_WIDTH - DISPLAY_OVERLAY_WIDTH) / 2)
+#if (DISPLAY_FLIP_VERTICAL != 0)
+#define DISPLAY_OVERLAY_Y   (DISPLAY_IMAGE_Y - DISPLAY_OVERLAY_GAP - DISPLAY_OVERLAY_HEIGHT)
+#else
+#define DISPLAY_OVERLAY_Y   (DISPLAY_IMAGE_Y + IMAGE_HEIGHT + DISPLAY_OVERLAY_GAP)
+#endif
+
+/* Display statistics: frames passed to the display and frames skipped (no free frame buffer) */
+extern "C" {
+uint32_t display_frames_presented = 0U;
+uint32_t display_frames_skipped   = 0U;
+}
+
+#if ML_MOTION_GATE
+/* Output data of the last inferred frame, reused for gated frames */
+static uint8_t gate_out_buf[SDS_ALGO_DATA_OUT_BLOCK_SIZE];
+#endif
+
+/* Models loaded at initialization, the first one is active. Further models
+   (up to ML_MAX_MODELS) are added from their own PTE headers. */
+static const struct {
+    const void *pte;
+    size_t      size;
+    int         config;
+} model_table[] = {
+    { model_pte, sizeof(model_pte), RPS_MODEL },
+};
+
+#define MODEL_COUNT  (sizeof(model_table) / sizeof(model_table[0]))
+
+static_assert(MODEL_COUNT <= ML_MAX_MODELS,
+              "More models than ML_MAX_MODELS, check ML_MAX_MODELS definition.");
+
+/* Runner state of the active model – must survive across ExecuteAlgorithm() calls */
 static RunnerContext *ctx = nullptr;
 
-/* In-place storage for BufferDataLoader and Result<Program> (no heap) */
-static uint8_t loader_storage[sizeof(BufferDataLoader)]
+/* In-place storage for BufferDataLoader and Result<Program> of each model (no heap) */
+static uint8_t loader_storage[MODEL_COUNT][sizeof(BufferDataLoader)]
     __attribute__((aligned(alignof(BufferDataLoader))));
-static uint8_t program_result_storage[sizeof(Result<Program>)]
+static uint8_t program_result_storage[MODEL_COUNT][sizeof(Result<Program>)]
     __attribute__((aligned(alignof(Result<Program>))));
 
-/* Pointers into the above storage */
-static BufferDataLoader *loader_ptr  = nullptr;
-static Program          *program_ptr = nullptr;
+/* Model switch requests (SelectNextModel) and the number applied so far */
+static volatile uint32_t model_switch_requested = 0U;
+static uint32_t          model_switch_applied   = 0U;
+static size_t            model_active           = 0U;
+
+/* ETDump requests (RequestETDump) and the number written so far */
+static volatile uint32_t etdump_requested = 0U;
+static uint32_t          etdump_written   = 0U;
 
 /* Reference to the underlying CMSIS vStream VideoOut driver */
 extern vStreamDriver_t Driver_vStreamVideoOut;
@@ -70,6 +128,200 @@ static void VideoOut_Event_Callback(uint32_t event) {
     (void)event;
 }
 
+/* CPU cycles per tenth of a millisecond */
+#define CYCLES_PER_TENTH_MS  (CPU_FREQ_HZ / 10000U)
+
+/* Show frame rate, algorithm latency and display counters on the overlay,
+   in integer tenths so the text needs no floating-point formatting */
+static void UpdateOverlayStats(uint32_t frame_start, uint32_t algo_cycles) {
+    static uint32_t prev_start = 0U;
+    static bool     prev_valid = false;
+    char            text[DISPLAY_OVERLAY_STATS_SIZE];
+    uint32_t        fps     = 0U;
+    uint32_t        latency = algo_cycles / CYCLES_PER_TENTH_MS;
+    uint32_t        period;
+
+    if (prev_valid) {
+        period = (frame_start - prev_start) / CYCLES_PER_TENTH_MS;
+        if (period != 0U) {
+            fps = 100000U / period;
+        }
+    }
+    prev_start = frame_start;
+    prev_valid = true;
+
+#if ML_MOTION_GATE
+    snprintf(text, sizeof(text), "FPS %u.%u  LATENCY %u.%u MS\nSHOWN %u  SKIPPED %u\nINFERRED %u  GATED %u",
+             (unsigned int)(fps / 10U), (unsigned int)(fps % 10U),
+             (unsigned int)(latency / 10U), (unsigned int)(latency % 10U),
+             (unsigned int)display_frames_presented, (unsigned int)display_frames_skipped,
+             (unsigned int)motion_gate_frames_inferred, (unsigned int)motion_gate_frames_gated);
+#else
+    snprintf(text, sizeof(text), "FPS %u.%u  LATENCY %u.%u MS\nSHOWN %u  SKIPPED %u",
+             (unsigned int)(fps / 10U), (unsigned int)(fps % 10U),
+             (unsigned int)(latency / 10U), (unsigned int)(latency % 10U),
+             (unsigned int)display_frames_presented, (unsigned int)display_frames_skipped);
+#endif
+    display_overlay_set_stats(text);
+}
+
+#if ENABLE_TIME_PROFILING
+/* Display cycles of the frame being presented (ML image and overlay) */
+static uint32_t display_cycles = 0U;
+#endif
+
+/* Copy the ML image to a free LCD frame buffer. Returns the frame buffer,
+   or NULL when the frame is skipped because the display uses all of them. */
+static uint8_t *BeginFrame(const uint8_t *in_buf) {
+    uint8_t *outFrame;
+
+#if (DISPLAY_FRAME_BLOCKS == 1)
+    vStreamStatus_t v_status;
+
+    /* Single frame buffer: wait until the display has shown the previous frame */
+    do {
+        v_status = vStream_VideoOut->GetStatus();
+    } while (v_status.active == 1U);
+#endif
+
+    /* With several frame buffers take a free one, never wait for the display */
+    outFrame = (uint8_t *)vStream_VideoOut->GetBlock();
+    if (outFrame == NULL) {
+        /* All frame buffers are in use by the display: skip this frame */
+        display_frames_skipped++;
+        return NULL;
+    }
+
+#if ENABLE_TIME_PROFILING
+    uint32_t display_time = profiler_start();
+#endif
+    timeline_begin(TIMELINE_BLIT);
+
+    image_copy_to_framebuffer(
+        in_buf,
+        IMAGE_WIDTH,  IMAGE_HEIGHT,
+        outFrame,
+        DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT,
+        DISPLAY_IMAGE_X,
+        DISPLAY_IMAGE_Y,
+        IMAGE_FORMAT_RGB888,
+        DISPLAY_FLIP_HORIZONTAL,
+        DISPLAY_FLIP_VERTICAL,
+        DISPLAY_SWAP_RB);
+
+    timeline_end(TIMELINE_BLIT);
+
+#if ENABLE_TIME_PROFILING
+    display_cycles = profiler_stop(display_time);
+#endif
+
+    return outFrame;
+}
+
+/* Draw the overlay into the frame buffer from BeginFrame() and pass it to the
+   display. The overlay shows the current result; the statistics are those of
+   the previous frame, whose time includes its display. */
+static void FinishFrame(uint8_t *outFrame) {
+
+    if (outFrame == NULL) {
+        return;
+    }
+
+#if ENABLE_TIME_PROFILING
+    uint32_t display_time = profiler_start();
+#endif
+    timeline_begin(TIMELINE_BLIT);
+
+    display_overlay_draw(
+        outFrame,
+        DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT,
+        DISPLAY_OVERLAY_X,
+        DISPLAY_OVERLAY_Y,
+        DISPLAY_FLIP_HORIZONTAL,
+        DISPLAY_FLIP_VERTICAL,
+        DISPLAY_SWAP_RB);
+
+    timeline_end(TIMELINE_BLIT);
+
+#if ENABLE_TIME_PROFILING
+    display_time = display_cycles + profiler_stop(display_time);
+    LOG_MSG(LOG_DISPLAY_TIME, LOG_U(display_time));
+    latency_hist_add(LATENCY_DISPLAY, display_time);
+#endif
+
+    if (vStream_VideoOut->ReleaseBlock() != VSTREAM_OK) {
+        printf("Failed to release video output frame\n");
+    }
+
+    /* Display the frame (starts the stream, then flips on vertical sync) */
+    if (vStream_VideoOut->Start(DISPLAY_STREAM_MODE) != VSTREAM_OK) {
+        printf("Failed to start video output\n");
+    } else {
+        display_frames_presented++;
+    }
+}
+
+/* Pre-processing, inference and post-processing of one frame. The ML image
+   is copied to the display while the NPU job runs, the overlay with the
+   result is drawn after post-processing, so the result is shown with its
+   own frame. */
+static int32_t RunInference(uint8_t *in_buf, uint8_t *out_buf, uint32_t out_num) {
+    uint8_t *outFrame;
+
+    /* ---- Pre-processing: HWC→CHW + ImageNet normalisation ---- */
+#if ENABLE_TIME_PROFILING
+    uint32_t pre_process_time = profiler_start();
+#endif
+    timeline_begin(TIMELINE_PREPROCESS);
+
+    preprocess(in_buf);
+
+    timeline_end(TIMELINE_PREPROCESS);
+
+#if ENABLE_TIME_PROFILING
+    pre_process_time = profiler_stop(pre_process_time);
+    LOG_MSG(LOG_PRE_PROCESS_TIME, LOG_U(pre_process_time));
+    latency_hist_add(LATENCY_PRE_PROCESS, pre_process_time);
+#endif
+
+    /* ---- Inference: start the NPU job ---- */
+    if (!run_inference_start(*ctx)) {
+        printf("Inference failed.\n");
+        return -1;
+    }
+
+    /* ---- Display: copy the ML image while the NPU job runs ---- */
+    outFrame = BeginFrame(in_buf);
+
+    /* ---- Inference: wait for the NPU job and finish the model ---- */
+    if (!run_inference_wait(*ctx)) {
+        printf("Inference failed.\n");
+        FinishFrame(outFrame);
+        return -1;
+    }
+
+    /* ---- Post-processing: decode output tensor into output_label ---- */
+#if ENABLE_TIME_PROFILING
+    uint32_t post_process_time = profiler_start();
+#endif
+    timeline_begin(TIMELINE_POSTPROCESS);
+
+    postprocess(*ctx, out_buf, out_num);
+
+    timeline_end(TIMELINE_POSTPROCESS);
+
+#if ENABLE_TIME_PROFILING
+    post_process_time = profiler_stop(post_process_time);
+    LOG_MSG(LOG_POST_PROCESS_TIME, LOG_U(post_process_time));
+    latency_hist_add(LATENCY_POST_PROCESS, post_process_time);
+#endif
+
+    /* ---- Display: overlay with the result of this frame ---- */
+    FinishFrame(outFrame);
+
+    return 0;
+}
+
 /* ============================================================================
  * InitAlgorithm
  * ============================================================================
@@ -93,32 +345,56 @@ int32_t InitAlgorithm(void) {
         return -1;
     }
 
-    /* ---- Model Loading ---- */
-    size_t pte_size = sizeof(model_pte);
-
-    /* Construct BufferDataLoader in-place (no heap allocation) */
-    loader_ptr = new (loader_storage) BufferDataLoader(model_pte, pte_size);
-
-    /* Load the ExecuTorch program in-place */
-    auto *program_result = new (program_result_storage)
-        Result<Program>(Program::load(loader_ptr));
+    /* Label and confidence bars are shown on an overlay next to the ML image */
+    display_overlay_init();
 
-    if (!program_result->ok()) {
-        printf("Program loading failed: 0x%" PRIx32 "\n",
-               (uint32_t)program_result->error());
-        return -1;
+    /* ---- Model Loading ---- */
+    runner_model_t models[MODEL_COUNT];
+
+    for (size_t i = 0U; i < MODEL_COUNT; i++) {
+        /* Construct BufferDataLoader in-place (no heap allocation) */
+        auto *loader = new (loader_storage[i])
+            BufferDataLoader(model_table[i].pte, model_table[i].size);
+
+        /* Load the ExecuTorch program in-place */
+        auto *program_result = new (program_result_storage[i])
+            Result<Program>(Program::load(loader));
+
+        if (!program_result->ok()) {
+            printf("Program %u loading failed: 0x%" PRIx32 "\n",
+                   (unsigned int)i, (uint32_t)program_result->error());
+            return -1;
+        }
+
+        models[i].program  = &program_result->get();
+        models[i].pte      = model_table[i].pte;
+        models[i].pte_size = model_table[i].size;
+        models[i].config   = model_table[i].config;
     }
 
-    program_ptr = &program_result->get();
-
-    /* ---- Runner Init (loads model method into RunnerContext) ---- */
+    /* ---- Runner Init (loads each model method into its RunnerContext) ---- */
+    runner_init_models(models, MODEL_COUNT);
     ctx = runner_context_instance();
-    std::vector<std::pair<char *, size_t>> input_buffers; /* empty on init */
-    runner_init(*ctx, input_buffers, pte_size, program_ptr);
 
     return 0;
 }
 
+/**
+  \fn           void SelectNextModel (void)
+  \brief        Request switching to the next loaded model.
+*/
+void SelectNextModel(void) {
+    model_switch_requested = model_switch_requested + 1U;
+}
+
+/**
+  \fn           void RequestETDump (void)
+  \brief        Request writing the recorded profiling events as ETDump.
+*/
+void RequestETDump(void) {
+    etdump_requested = etdump_requested + 1U;
+}
+
 /* ============================================================================
  * ExecuteAlgorithm
  * ============================================================================
@@ -136,85 +412,55 @@ int32_t InitAlgorithm(void) {
 int32_t ExecuteAlgorithm(uint8_t *in_buf, uint32_t in_num,
                          uint8_t *out_buf, uint32_t out_num) {
 
-    vStreamStatus_t v_status;
-    uint8_t        *outFrame;
+    uint32_t        frame_start = profiler_start();
 
     /* Clear output buffer */
     memset(out_buf, 0, out_num);
 
-    /* ---- Pre-processing: HWC→CHW + ImageNet normalisation ---- */
-#if ENABLE_TIME_PROFILING
-    uint32_t pre_process_time = profiler_start();
-#endif
-
-    preprocess(in_buf);
+    /* ---- ETDump: write the profiling events recorded so far, between inferences ---- */
+    if (etdump_written != etdump_requested) {
+        etdump_written = etdump_requested;
+        write_etdump(*ctx);
+    }
 
-#if ENABLE_TIME_PROFILING
-    pre_process_time = profiler_stop(pre_process_time);
-    printf("Pre Processing time: %3.3f ms.\n",
-           profiler_cycles_to_ms(pre_process_time, CPU_FREQ_HZ));
+    /* ---- Model switch: make the next loaded model active, no reload ---- */
+    if (model_switch_applied != model_switch_requested) {
+        model_switch_applied = model_switch_requested;
+        model_active = (model_active + 1U) % runner_model_count();
+        ctx = runner_select_model(model_active);
+        printf("Model %u active\n", (unsigned int)model_active);
+#if ML_MOTION_GATE
+        /* The last result belongs to the previous model */
+        motion_gate_reset();
 #endif
+    }
 
-    /* ---- Inference ---- */
-    if (!run_inference(*ctx)) {
-        printf("Inference failed.\n");
+#if ML_MOTION_GATE
+    /* ---- Motion gate: reuse the result of the last inferred frame for an unchanged scene ---- */
+    if (motion_gate_check(in_buf, IMAGE_WIDTH, IMAGE_HEIGHT) != 0) {
+        memcpy(out_buf, gate_out_buf, (out_num < sizeof(gate_out_buf)) ? out_num : sizeof(gate_out_buf));
+        FinishFrame(BeginFrame(in_buf));
+    } else if (RunInference(in_buf, out_buf, out_num) == 0) {
+        memcpy(gate_out_buf, out_buf, (out_num < sizeof(gate_out_buf)) ? out_num : sizeof(gate_out_buf));
+    } else {
+        motion_gate_reset();
         return -1;
     }
-
-    /* ---- Post-processing: decode output tensor into output_label ---- */
-#if ENABLE_TIME_PROFILING
-    uint32_t post_process_time = profiler_start();
-#endif
-
-    postprocess(*ctx, in_buf, out_buf, out_num);
-
-#if ENABLE_TIME_PROFILING
-    post_process_time = profiler_stop(post_process_time);
-    printf("Post Process time: %3.3f ms.\n",
-           profiler_cycles_to_ms(post_process_time, CPU_FREQ_HZ));
-#endif
-
-    /* ---- Display: copy ML frame to LCD framebuffer ---- */
-#if ENABLE_TIME_PROFILING
-    uint32_t display_time = profiler_start();
-#endif
-
-    /* Wait for previous video output frame to finish */
-    do {
-        v_status = vStream_VideoOut->GetStatus();
-    } while (v_status.active == 1U);
-
-    outFrame = (uint8_t *)vStream_VideoOut->GetBlock();
-    if (outFrame == NULL) {
-        printf("Failed to get video output frame\n");
+#else
+    if (RunInference(in_buf, out_buf, out_num) != 0) {
         return -1;
     }
+#endif
 
-    image_copy_to_framebuffer(
-        in_buf,
-        IMAGE_WIDTH,  IMAGE_HEIGHT,
-        outFrame,
-        DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT,
-        (DISPLAY_FRAME_WIDTH  - IMAGE_WIDTH)  / 2,
-        (DISPLAY_FRAME_HEIGHT - IMAGE_HEIGHT) / 2,
-        IMAGE_FORMAT_RGB888,
-        DISPLAY_FLIP_HORIZONTAL,
-        DISPLAY_FLIP_VERTICAL,
-        DISPLAY_SWAP_RB);
+    /* Statistics are shown on the next presented frame */
+    UpdateOverlayStats(frame_start, profiler_stop(frame_start));
 
 #if ENABLE_TIME_PROFILING
-    display_time = profiler_stop(display_time);
-    printf("Display time: %3.3f ms.\n",
-           profiler_cycles_to_ms(display_time, CPU_FREQ_HZ));
+    LOG_MSG(LOG_DISPLAY_FRAMES, LOG_U(display_frames_presented), LOG_U(display_frames_skipped));
+#if ML_MOTION_GATE
+    LOG_MSG(LOG_MOTION_GATE_FRAMES, LOG_U(motion_gate_frames_inferred), LOG_U(motion_gate_frames_gated));
+#endif
 #endif
-
-    if (vStream_VideoOut->ReleaseBlock() != VSTREAM_OK) {
-        printf("Failed to release video output frame\n");
-    }
-
-    if (vStream_VideoOut->Start(VSTREAM_MODE_SINGLE) != VSTREAM_OK) {
-        printf("Failed to start video output\n");
-    }
 
     return 0;
 }
\ No newline at end of file
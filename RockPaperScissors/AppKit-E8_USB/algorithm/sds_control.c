@@ -24,7 +24,11 @@
 #include "cmsis_vio.h"
 #include "sds_main.h"
 #include "sds_control.h"
+#include "sds_algorithm.h"
 #include "sds_rec_play.h"
+#include "log_ring.h"
+#include "latency_hist.h"
+#include "cpu_load.h"
 #ifdef   RTE_SDS_IO_SOCKET
 #include "sdsio_config_socket.h"
 #endif
@@ -47,8 +51,13 @@ sdsError_t sdsError = { 0U, 0U, NULL, 0U };
 // SDS streams status
 volatile uint8_t sdsStreamingState = SDS_STREAMING_INACTIVE;
 
+#if CPU_LOAD_ENABLE
+// CPU load of the last 1 second interval
+static cpu_load_t cpu_load;
+#else
 // Idle time counter
 static volatile uint32_t idle_cnt;
+#endif
 
 // Command received over STDIN
 static volatile char stdin_cmd = 0;
@@ -116,20 +125,24 @@ __NO_RETURN void StdinPollThread (void *argument) {
 
 // Recording/playback control thread function.
 // Toggle recording/playback via USER push-button or receiving 's' via STDIO interface.
-// Toggle LED0 every 1 second to see that the thread is alive.
+// Toggle LED0 every 1 second to see that the thread is alive and print the CPU load.
 // Turn on LED1 when recording/playback is started, turn it off when recording/playback is stopped.
 __NO_RETURN void sdsControlThread (void *argument) {
   uint8_t btn_val, keypress;
   uint8_t btn_prev = 0U;
   uint8_t led0_val = 0U;
+#if !CPU_LOAD_ENABLE
   uint32_t no_load_cnt, prev_cnt;
+#endif
   uint32_t interval_time, cnt = 0U;
   int32_t ret;
 
+#if !CPU_LOAD_ENABLE
   // Initialize idle counter
   idle_cnt = 0U;
   osDelay(10U);
   no_load_cnt = idle_cnt;
+#endif
 
   // Initialize SDS recorder/player
   ret = sdsRecPlayInit(rec_play_event_callback);
@@ -188,6 +201,11 @@ __NO_RETURN void sdsControlThread (void *argument) {
       break;
   }
 
+  // Create log thread (drains deferred log messages)
+  if (log_ring_init() != 0) {
+    printf("Log Thread creation failed!\n");
+  }
+
   // Create algorithm thread
   if (osThreadNew(AlgorithmThread, NULL, &attrAlgorithmThread) == NULL) {
     printf("Algorithm Thread creation failed!\n");
@@ -201,7 +219,11 @@ __NO_RETURN void sdsControlThread (void *argument) {
   }
 
   interval_time = osKernelGetTickCount();
+#if CPU_LOAD_ENABLE
+  (void)cpu_load_update(&cpu_load);
+#else
   prev_cnt      = idle_cnt;
+#endif
 
   for (;;) {
     // Monitor user button
@@ -215,6 +237,10 @@ __NO_RETURN void sdsControlThread (void *argument) {
 
     // Handle command received over STDIN
     // 's' or 'S' emulate button press, thus start/stop the recording or playback
+    // 'm' or 'M' switch to the next loaded model
+    // 'e' or 'E' write the ExecuTorch profiling events as ETDump
+    // 'p' or 'P' print the latency percentiles of the pipeline stages
+    // 'r' or 'R' reset the latency histograms
     switch (stdin_cmd) {
       case 's':
       case 'S':
@@ -222,6 +248,30 @@ __NO_RETURN void sdsControlThread (void *argument) {
         stdin_cmd = 0;
         break;
 
+      case 'm':
+      case 'M':
+        SelectNextModel();
+        stdin_cmd = 0;
+        break;
+
+      case 'e':
+      case 'E':
+        RequestETDump();
+        stdin_cmd = 0;
+        break;
+
+      case 'p':
+      case 'P':
+        latency_hist_print();
+        stdin_cmd = 0;
+        break;
+
+      case 'r':
+      case 'R':
+        latency_hist_reset();
+        stdin_cmd = 0;
+        break;
+
       default:
         break;
     }
@@ -274,9 +324,17 @@ __NO_RETURN void sdsControlThread (void *argument) {
     if (++cnt == 10U) {
       cnt = 0U;
 
+#if CPU_LOAD_ENABLE
+      // Print and record CPU load per thread
+      if (cpu_load_update(&cpu_load) != 0U) {
+        cpu_load_print(&cpu_load);
+        RecordCpuLoad(&cpu_load);
+      }
+#else
       // Print idle factor
       printf("%d%% idle\n",(idle_cnt - prev_cnt) / no_load_cnt);
       prev_cnt = idle_cnt;
+#endif
 
       // Toggle LED0
       led0_val ^= 1U;
@@ -285,6 +343,7 @@ __NO_RETURN void sdsControlThread (void *argument) {
   }
 }
 
+#if !CPU_LOAD_ENABLE
 // Measure system idle time
 __NO_RETURN void osRtxIdleThread(void *argument) {
   (void)argument;
@@ -293,3 +352,4 @@ __NO_RETURN void osRtxIdleThread(void *argument) {
     idle_cnt++;
   }
 }
+#endif
@@ -18,7 +18,6 @@
 
 #include <stddef.h>
 #include <stdio.h>
-#include <string.h>
 
 #include "cmsis_os2.h"
 #include "cmsis_vstream.h"
@@ -27,7 +26,10 @@
 #include "sds_data_in.h"
 
 #include "app_setup.h"
+#include "config_buf.h"
 #include "image_processing_func.h"
+#include "profiler.h"
+#include "log_ring.h"
 
 /* Reference to the underlying CMSIS vStream VideoIn driver */
 extern vStreamDriver_t          Driver_vStreamVideoIn;
@@ -37,21 +39,48 @@ extern vStreamDriver_t          Driver_vStreamVideoIn;
 extern vStreamDriver_t          Driver_vStreamVideoOut;
 #define vStream_VideoOut      (&Driver_vStreamVideoOut)
 
-/* Camera frame buffer (RAW8 or RGB565) */
-static uint8_t CAM_Frame[CAMERA_FRAME_SIZE] CAMERA_FRAME_BUF_ATTRIBUTE;
+#if (CAMERA_FRAME_BLOCKS == 2)
+#error "Continuous capture needs at least 3 camera frame blocks, check CAMERA_FRAME_BLOCKS definition."
+#endif
 
-/* RGB image buffer (RGB888) */
-static uint8_t RGB_Image[RGB_IMAGE_SIZE] RGB_IMAGE_BUF_ATTRIBUTE;
+/* Camera frame buffer (RAW8 or RGB565), ring of CAMERA_FRAME_BLOCKS frames */
+static uint8_t CAM_Frame[CAMERA_FRAME_BLOCKS * CAMERA_FRAME_SIZE] CAMERA_FRAME_BUF_ATTRIBUTE;
 
-static void convert_frame_to_rgb(uint8_t *inFrame);
+#if (CAMERA_FRAME_BLOCKS > 1)
+/* Continuous capture state */
+static uint8_t           capture_started = 0U;
+static volatile uint32_t frames_done     = 0U;    /* Completed frames, written by callback only   */
+static uint32_t          frames_taken    = 0U;    /* Frames taken from the ring by GetInputData   */
 
-/* Algorithm thread ID */
+/* Number of captured frames dropped in favour of a newer frame */
+uint32_t capture_frames_dropped = 0U;
+
+#if ENABLE_TIME_PROFILING
+/* Dropped frame count last written to the log */
+static uint32_t capture_frames_dropped_logged = 0U;
+#endif
+
+static int32_t start_continuous_capture(void);
+#endif
+
+#if (CAMERA_FRAME_TYPE != CAMERA_FRAME_TYPE_RAW8)
+/* Camera frame to ML model input resize plan */
+static image_resize_plan_t ml_resize_plan;
+#endif
+
+static void transform_frame_to_ml(const uint8_t *inFrame, uint8_t *buf);
+
+/* ID of the thread acquiring input data */
 osThreadId_t tid_algo = NULL;
 
 /* Video In Stream Event Callback */
 void VideoIn_Event_Callback (uint32_t event) {
 
   if (event & VSTREAM_EVENT_DATA) {
+#if (CAMERA_FRAME_BLOCKS > 1)
+    /* Another block of the ring holds a completed frame */
+    frames_done++;
+#endif
     /* Video frame is available in camera frame buffer */
     osThreadFlagsSet(tid_algo, 0x1);
   }
@@ -71,6 +100,28 @@ int32_t InitInputData (void) {
 
   tid_algo = osThreadGetId();
 
+#if (CAMERA_FRAME_TYPE != CAMERA_FRAME_TYPE_RAW8)
+  /* Build camera frame to ML model input resize plan */
+  if (image_resize_plan_init(&ml_resize_plan,
+                             CAMERA_FRAME_WIDTH,
+                             CAMERA_FRAME_HEIGHT,
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
+                             IMAGE_FORMAT_RGB565,
+#else
+                             IMAGE_FORMAT_RGB888,
+#endif
+                             ML_CROP_X,
+                             ML_CROP_Y,
+                             ML_CROP_WIDTH,
+                             ML_CROP_HEIGHT,
+                             ML_IMAGE_WIDTH,
+                             ML_IMAGE_HEIGHT,
+                             CAMERA_RESIZE_MODE) != 0) {
+    printf("Failed to build resize plan for ML model input\n");
+    return -1;
+  }
+#endif
+
   /* Initialize Video Input Stream */
   if (vStream_VideoIn->Initialize(VideoIn_Event_Callback) != VSTREAM_OK) {
     printf("Failed to initialise video input driver\n");
@@ -96,6 +147,9 @@ int32_t InitInputData (void) {
 */
 int32_t GetInputData (uint8_t *buf, uint32_t max_len) {
   uint8_t *inFrame;
+#if (CAMERA_FRAME_BLOCKS > 1)
+  vStreamStatus_t status;
+#endif
 
   // Check input parameters
   if ((buf == NULL) || (max_len == 0U)) {
@@ -107,6 +161,40 @@ int32_t GetInputData (uint8_t *buf, uint32_t max_len) {
     return -1;
   }
 
+#if (CAMERA_FRAME_BLOCKS > 1)
+  if (capture_started == 0U) {
+    /* Start continuous video capture on first request */
+    if (start_continuous_capture() != 0) {
+      return -1;
+    }
+    capture_started = 1U;
+  }
+
+  /* Wait for at least one completed video input frame */
+  while ((frames_done - frames_taken) == 0U) {
+    osThreadFlagsWait(0x1, osFlagsWaitAny, osWaitForever);
+
+    status = vStream_VideoIn->GetStatus();
+    if ((status.overflow != 0U) || (status.eos != 0U)) {
+      /* Ring was overrun or stream ended, frames in the ring are not reliable: restart capture */
+      capture_frames_dropped += frames_done - frames_taken;
+      if (start_continuous_capture() != 0) {
+        capture_started = 0U;
+        return -1;
+      }
+    }
+  }
+
+  /* Drop stale frames, newest completed frame wins */
+  while ((frames_done - frames_taken) > 1U) {
+    if ((vStream_VideoIn->GetBlock() == NULL) || (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK)) {
+      break;
+    }
+    frames_taken++;
+    capture_frames_dropped++;
+  }
+  frames_taken++;
+#else
   /* Start video capture */
   if (vStream_VideoIn->Start(VSTREAM_MODE_SINGLE) != VSTREAM_OK) {
     printf("Failed to start video capture\n");
@@ -115,6 +203,7 @@ int32_t GetInputData (uint8_t *buf, uint32_t max_len) {
 
   /* Wait for new video input frame */
   osThreadFlagsWait(0x1, osFlagsWaitAny, osWaitForever);
+#endif
 
     /* Get input video frame buffer */
   inFrame = (uint8_t *)vStream_VideoIn->GetBlock();
@@ -123,138 +212,76 @@ int32_t GetInputData (uint8_t *buf, uint32_t max_len) {
     return -1;
   }
 
-  /* Convert input frame and place it into RGB_Image buffer */
-  convert_frame_to_rgb(inFrame);
-
-  /* Resize RGB image to fit ML model expected size */
-  crop_resize_rgb565_to_rgb888(inFrame,
-                               CAMERA_FRAME_WIDTH,
-                               CAMERA_FRAME_HEIGHT,
-                               buf,
-                               ML_IMAGE_WIDTH,
-                               ML_IMAGE_HEIGHT);
-
+  /* Crop, resize and convert input frame to ML model input */
+  transform_frame_to_ml(inFrame, buf);
 
   /* Release input frame */
   if (vStream_VideoIn->ReleaseBlock() != VSTREAM_OK) {
     printf("Failed to release video input frame\n");
   }
 
+#if (CAMERA_FRAME_BLOCKS > 1) && ENABLE_TIME_PROFILING
+  if (capture_frames_dropped != capture_frames_dropped_logged) {
+    capture_frames_dropped_logged = capture_frames_dropped;
+    LOG_MSG(LOG_CAPTURE_DROPPED, LOG_U(capture_frames_dropped));
+  }
+#endif
+
   return SDS_ALGO_DATA_IN_BLOCK_SIZE;
 }
 
+#if (CAMERA_FRAME_BLOCKS > 1)
+/*
+  (Re)starts continuous capture into the camera frame ring.
+
+  Stops the stream if it is active, resets the ring indexes and discards
+  the frames still counted as completed.
+*/
+static int32_t start_continuous_capture(void) {
+
+  if (vStream_VideoIn->Stop() != VSTREAM_OK) {
+    printf("Failed to stop video capture\n");
+    return -1;
+  }
+
+  /* Set Input Video buffer, resets ring indexes */
+  if (vStream_VideoIn->SetBuf(CAM_Frame, sizeof(CAM_Frame), CAMERA_FRAME_SIZE) != VSTREAM_OK) {
+    printf("Failed to set buffer for video input\n");
+    return -1;
+  }
+  frames_taken = frames_done;
+
+  if (vStream_VideoIn->Start(VSTREAM_MODE_CONTINUOUS) != VSTREAM_OK) {
+    printf("Failed to start video capture\n");
+    return -1;
+  }
+
+  return 0;
+}
+#endif
+
 /*
-  Converts camera frame and copies it to RGB image buffer.
-
-  Camera frame may be square or non-square and must be in RAW8 or RGB565 format.
-  RGB image buffer is always square and is in RGB888 format.
-
-  The function handles the following cases:
-    - If the camera frame is square and matches the RGB image size:
-      - crop and debayer the RAW8 camera frame
-      - convert RGB565 camera frame to RGB888
-      - copy RGB888 camera frame to RGB image buffer.
-    - If the camera frame is square and larger than the RGB image size:
-      - crop and debayer the RAW8 camera frame
-      - resize RGB565 camera frame to fit into RGB image buffer.
-      - resize RGB888 camera frame to fit into RGB image buffer.
-    - If the camera frame is not square:
-      - crop and debayer the RAW8 camera frame
-      - crop RGB565 camera frame to fit into RGB image buffer.
-      - crop RGB888 camera frame to fit into RGB image buffer.
+  Transforms camera frame into ML model input (RGB888, ML_IMAGE_WIDTH x ML_IMAGE_HEIGHT).
+
+  The centred ML_CROP_WIDTH x ML_CROP_HEIGHT region of the camera frame is
+  cropped, resized and converted in a single pass:
+    - RAW8 camera frame is debayered while sampling.
+    - RGB565 and RGB888 camera frames are resampled with the resize plan
+      built in InitInputData (CAMERA_RESIZE_MODE), RGB565 is expanded to
+      RGB888 while sampling.
 */
-static void convert_frame_to_rgb(uint8_t *inFrame) {
-    #if (CAMERA_FRAME_WIDTH == CAMERA_FRAME_HEIGHT)
-      /* Camera frame is square */
-      #if (CAMERA_FRAME_WIDTH == RGB_IMAGE_WIDTH) && (CAMERA_FRAME_HEIGHT == RGB_IMAGE_HEIGHT)
-        /* Camera frame size matches RGB image size */
-        #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
-            /* For RAW8, crop and debayer into RGB image buffer (RGB888) */
-            crop_and_debayer(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            0, 0, /* Crop from top-left corner */
-                            RGB_Image,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT,
-                            CAMERA_FRAME_BAYER);
-        #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
-            /* For RGB565, convert frame to fit into RGB image buffer (RGB888) */
-            convert_rgb565_to_rgb888(inFrame, RGB_Image, CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT);
-        #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB888)
-            /* For RGB888, just copy the frame */
-            memcpy(RGB_Image, inFrame, CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT * 3);
-        #endif
-      #else
-        /* Camera frame size is larger than RGB image size */
-        #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
-            /* For RAW8, crop and debayer into RGB image buffer (RGB888) */
-            crop_and_debayer(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                            (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                            RGB_Image,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT,
-                            CAMERA_FRAME_BAYER);
-        #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
-            /* For RGB565, resize frame to fit into RGB image buffer (RGB888) */
-            image_resize(inFrame,
-                        CAMERA_FRAME_WIDTH,
-                        CAMERA_FRAME_HEIGHT,
-                        RGB_Image,
-                        RGB_IMAGE_WIDTH,
-                        RGB_IMAGE_HEIGHT,
-                        IMAGE_FORMAT_RGB565,
-                        IMAGE_FORMAT_RGB888);
-        #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB888)
-            /* For RGB888, resize frame to fit into RGB image buffer (RGB888) */
-            image_resize(inFrame,
-                        CAMERA_FRAME_WIDTH,
-                        CAMERA_FRAME_HEIGHT,
-                        RGB_Image,
-                        RGB_IMAGE_WIDTH,
-                        RGB_IMAGE_HEIGHT,
-                        IMAGE_FORMAT_RGB888,
-                        IMAGE_FORMAT_RGB888);
-        #endif
-      #endif
-    #endif
-
-    #if (CAMERA_FRAME_WIDTH != CAMERA_FRAME_HEIGHT)
-      /* Camera frame is not square, crop it to fit RGB buffer */
-      #if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
-        /* For RAW8, crop and debayer to RGB888 */
-        crop_and_debayer(inFrame,
-                        CAMERA_FRAME_WIDTH,
-                        CAMERA_FRAME_HEIGHT,
-                        (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                        (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                        RGB_Image,
-                        RGB_IMAGE_WIDTH,
-                        RGB_IMAGE_HEIGHT,
-                        CAMERA_FRAME_BAYER);
-      #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB565)
-        /* For RGB565, crop and convert to RGB888 */
-        crop_rgb565_to_rgb888(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            RGB_Image,
-                            (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                            (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT);
-      #elif (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RGB888)
-        /* For RGB888, just crop */
-        crop_rgb888_to_rgb888(inFrame,
-                            CAMERA_FRAME_WIDTH,
-                            CAMERA_FRAME_HEIGHT,
-                            RGB_Image,
-                            (CAMERA_FRAME_WIDTH - RGB_IMAGE_WIDTH) / 2, /* Center crop */
-                            (CAMERA_FRAME_HEIGHT - RGB_IMAGE_HEIGHT) / 2,
-                            RGB_IMAGE_WIDTH,
-                            RGB_IMAGE_HEIGHT);
-      #endif
-    #endif
+static void transform_frame_to_ml(const uint8_t *inFrame, uint8_t *buf) {
+#if (CAMERA_FRAME_TYPE == CAMERA_FRAME_TYPE_RAW8)
+  crop_and_debayer(inFrame,
+                   CAMERA_FRAME_WIDTH,
+                   CAMERA_FRAME_HEIGHT,
+                   ML_CROP_X,
+                   ML_CROP_Y,
+                   buf,
+                   ML_IMAGE_WIDTH,
+                   ML_IMAGE_HEIGHT,
+                   CAMERA_FRAME_BAYER);
+#else
+  image_resize_plan_run(&ml_resize_plan, inFrame, buf);
+#endif
 }
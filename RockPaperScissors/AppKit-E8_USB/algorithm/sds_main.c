@@ -26,6 +26,11 @@
 #include "sds_data_in.h"
 
 #include "profiler.h"
+#include "log_ring.h"
+#include "npu_pmu.h"
+#include "timeline.h"
+#include "latency_hist.h"
+#include "cpu_load.h"
 
 
 #ifdef SDS_PLAY
@@ -33,9 +38,36 @@
 extern uint32_t playTimestamp;
 #endif
 
+#if (SDS_ALGO_FRAME_SLOTS <= 1)
 // Algorithm input/output data buffer
 static uint8_t sds_algo_data_in_buf [SDS_ALGO_DATA_IN_BLOCK_SIZE]  __ALIGNED(4);
 static uint8_t sds_algo_data_out_buf[SDS_ALGO_DATA_OUT_BLOCK_SIZE] __ALIGNED(4);
+#else
+// Frame slot passed from the Capture thread to the Algorithm thread
+typedef struct {
+  uint8_t  data_in [SDS_ALGO_DATA_IN_BLOCK_SIZE]  __ALIGNED(4);
+  uint8_t  data_out[SDS_ALGO_DATA_OUT_BLOCK_SIZE] __ALIGNED(4);
+  uint32_t timestamp;           // Timestamp of input and output data records
+  uint32_t record;              // Non-zero if output data is to be recorded
+  uint32_t capture_begin;       // Cycle counter at capture begin (timeline)
+  uint32_t capture_end;         // Cycle counter at capture end (timeline)
+} sds_frame_slot_t;
+
+// Message sent instead of a slot index once capture stopped recording
+#define SDS_FRAME_SLOT_STOP     0xFFFFFFFFU
+
+// Algorithm input/output data buffers
+static sds_frame_slot_t sds_frame_slot[SDS_ALGO_FRAME_SLOTS];
+
+// Queues of free and filled frame slot indexes
+static osMessageQueueId_t frameFreeQueue;
+static osMessageQueueId_t frameFullQueue;
+
+// Capture thread attributes
+static const osThreadAttr_t attrCaptureThread = {
+  .name = "Capture"
+};
+#endif
 
 // SDS buffers
 #ifdef SDS_PLAY
@@ -44,6 +76,15 @@ static uint8_t sds_play_buf_data_in[((SDS_ALGO_DATA_IN_BLOCK_SIZE  * 2) + 2048)]
 static uint8_t sds_rec_buf_data_in [((SDS_ALGO_DATA_IN_BLOCK_SIZE  * 2) + 2048)] __ALIGNED(4);
 #endif
 static uint8_t sds_rec_buf_data_out[((SDS_ALGO_DATA_OUT_BLOCK_SIZE * 2) + 2048)] __ALIGNED(4);
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+static uint8_t sds_rec_buf_npu_pmu [((sizeof(npu_pmu_sample_t)    * 2) + 2048)] __ALIGNED(4);
+#endif
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+static uint8_t sds_rec_buf_timing  [((sizeof(timeline_record_t)   * 2) + 2048)] __ALIGNED(4);
+#endif
+#if (CPU_LOAD_ENABLE && CPU_LOAD_SDS)
+static uint8_t sds_rec_buf_cpu_load[((sizeof(cpu_load_t)          * 2) + 2048)] __ALIGNED(4);
+#endif
 
 // SDS identifiers
 #ifdef SDS_PLAY
@@ -52,6 +93,21 @@ static uint8_t sds_rec_buf_data_out[((SDS_ALGO_DATA_OUT_BLOCK_SIZE * 2) + 2048)]
 static sdsRecPlayId_t recIdDataInput  = NULL;
 #endif
 static sdsRecPlayId_t recIdDataOutput = NULL;
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+static sdsRecPlayId_t recIdNpuPmu     = NULL;
+
+// NPU PMU counters of the last inference
+static npu_pmu_sample_t npu_pmu_sample;
+#endif
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+static sdsRecPlayId_t recIdTiming     = NULL;
+
+// Frame timeline read from the timeline ring
+static timeline_record_t timeline_rec;
+#endif
+#if (CPU_LOAD_ENABLE && CPU_LOAD_SDS)
+static sdsRecPlayId_t recIdCpuLoad    = NULL;
+#endif
 
 // SDS file sequence number
 static uint32_t sequence_num = 0;
@@ -104,6 +160,43 @@ int32_t OpenStreams (void) {
     }
   }
 
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+  if (status == 0) {
+    // Open stream for recording of NPU PMU counters
+    recIdNpuPmu = sdsRecOpen("NPU_PMU", sds_rec_buf_npu_pmu, sizeof(sds_rec_buf_npu_pmu));
+    SDS_ASSERT(recIdNpuPmu != NULL);
+    if (recIdNpuPmu == NULL) {
+      printf("ERROR: Failed to open SDS stream for recording of NPU PMU counters!\n");
+      status = -1;
+    }
+  }
+#endif
+
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+  if (status == 0) {
+    // Open stream for recording of frame timelines, starting with the next frame
+    timeline_reset();
+    recIdTiming = sdsRecOpen("Timing", sds_rec_buf_timing, sizeof(sds_rec_buf_timing));
+    SDS_ASSERT(recIdTiming != NULL);
+    if (recIdTiming == NULL) {
+      printf("ERROR: Failed to open SDS stream for recording of frame timelines!\n");
+      status = -1;
+    }
+  }
+#endif
+
+#if (CPU_LOAD_ENABLE && CPU_LOAD_SDS)
+  if (status == 0) {
+    // Open stream for recording of CPU load
+    recIdCpuLoad = sdsRecOpen("CPU_Load", sds_rec_buf_cpu_load, sizeof(sds_rec_buf_cpu_load));
+    SDS_ASSERT(recIdCpuLoad != NULL);
+    if (recIdCpuLoad == NULL) {
+      printf("ERROR: Failed to open SDS stream for recording of CPU load!\n");
+      status = -1;
+    }
+  }
+#endif
+
 #ifdef SDS_PLAY
   if (status == 0) {
     printf("SDS playback and recording (#%d) started\n", sequence_num);
@@ -165,6 +258,30 @@ int32_t CloseStreams (void) {
     status = -1;
   }
 
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+  // Close stream for recording of NPU PMU counters
+  if (sdsRecClose(recIdNpuPmu) != SDS_REC_PLAY_OK) {
+    printf("ERROR: Failed to close SDS stream for recording of NPU PMU counters!\n");
+    status = -1;
+  }
+#endif
+
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+  // Close stream for recording of frame timelines
+  if (sdsRecClose(recIdTiming) != SDS_REC_PLAY_OK) {
+    printf("ERROR: Failed to close SDS stream for recording of frame timelines!\n");
+    status = -1;
+  }
+#endif
+
+#if (CPU_LOAD_ENABLE && CPU_LOAD_SDS)
+  // Close stream for recording of CPU load
+  if (sdsRecClose(recIdCpuLoad) != SDS_REC_PLAY_OK) {
+    printf("ERROR: Failed to close SDS stream for recording of CPU load!\n");
+    status = -1;
+  }
+#endif
+
 #ifdef SDS_PLAY
   if (status == 0) {
     printf("SDS playback and recording (#%d) stopped\n====\n\n", sequence_num);
@@ -183,7 +300,39 @@ int32_t CloseStreams (void) {
   return status;
 }
 
+/**
+  \fn           void RecordCpuLoad (const cpu_load_t *load)
+  \brief        Record the CPU load of a reporting interval while streaming is active.
+  \param[in]    load            CPU cycles of the interval
+*/
+void RecordCpuLoad (const cpu_load_t *load) {
+#if (CPU_LOAD_ENABLE && CPU_LOAD_SDS)
+  int32_t retv;
+
+  // Streams are open until closed by the caller (sdsControl thread) in state SDS_STREAMING_STOP_SAFE
+  if ((sdsStreamingState == SDS_STREAMING_ACTIVE) || (sdsStreamingState == SDS_STREAMING_STOP)) {
+    retv = sdsRecWrite(recIdCpuLoad, osKernelGetTickCount(), load, sizeof(cpu_load_t));
+    SDS_ASSERT(retv == sizeof(cpu_load_t));
+  }
+#else
+  (void)load;
+#endif
+}
+
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+// Record the completed frame timelines
+static void RecordTimeline (uint32_t timestamp) {
+  int32_t retv;
+
+  while (timeline_read(&timeline_rec) != 0U) {
+    retv = sdsRecWrite(recIdTiming, timestamp, &timeline_rec, sizeof(timeline_rec));
+    SDS_ASSERT(retv == sizeof(timeline_rec));
+  }
+}
+#endif
+
 
+#if (SDS_ALGO_FRAME_SLOTS <= 1)
 // Algorithm Thread function
 __NO_RETURN void AlgorithmThread (void *argument) {
   uint32_t timestamp;
@@ -206,9 +355,12 @@ __NO_RETURN void AlgorithmThread (void *argument) {
       sdsStreamingState = SDS_STREAMING_STOP_SAFE;
     }
 
+    timeline_frame_begin();
+
 #if ENABLE_TIME_PROFILING
     capture_time = profiler_start();
 #endif
+    timeline_begin(TIMELINE_CAPTURE);
 
     // Get a block of input data as required by algorithm under test
     if (GetInputData(sds_algo_data_in_buf, sizeof(sds_algo_data_in_buf)) != sizeof(sds_algo_data_in_buf)) {
@@ -218,8 +370,8 @@ __NO_RETURN void AlgorithmThread (void *argument) {
   
 #if ENABLE_TIME_PROFILING
     capture_time = profiler_stop(capture_time);
-    printf("Capture time: %3.3f ms.\n",
-           profiler_cycles_to_ms(capture_time, CPU_FREQ_HZ));
+    LOG_MSG(LOG_CAPTURE_TIME, LOG_U(capture_time));
+    latency_hist_add(LATENCY_CAPTURE, capture_time);
 #endif
 
 
@@ -232,6 +384,7 @@ __NO_RETURN void AlgorithmThread (void *argument) {
       SDS_ASSERT(retv == sizeof(sds_algo_data_in_buf));
     }
 #endif
+    timeline_end(TIMELINE_CAPTURE);
 
 #if ENABLE_TIME_PROFILING
     total_usecase_time = profiler_start();
@@ -245,8 +398,8 @@ __NO_RETURN void AlgorithmThread (void *argument) {
 
 #if ENABLE_TIME_PROFILING
     total_usecase_time = profiler_stop(total_usecase_time) + capture_time;
-    printf("Total usecase time: %3.3f ms.\n",
-            profiler_cycles_to_ms(total_usecase_time, CPU_FREQ_HZ));
+    LOG_MSG(LOG_TOTAL_TIME, LOG_U(total_usecase_time));
+    latency_hist_add(LATENCY_TOTAL, total_usecase_time);
 #endif
 
     if ((sdsStreamingState == SDS_STREAMING_ACTIVE) || (sdsStreamingState == SDS_STREAMING_STOP)) {
@@ -255,10 +408,191 @@ __NO_RETURN void AlgorithmThread (void *argument) {
       // exactly match those from the original recording
       timestamp = playTimestamp;
 #endif
+      timeline_begin(TIMELINE_RECORD);
 
       // Record algorithm output data
       retv = sdsRecWrite(recIdDataOutput, timestamp, sds_algo_data_out_buf, sizeof(sds_algo_data_out_buf));
       SDS_ASSERT(retv == sizeof(sds_algo_data_out_buf));
+
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+      // Record NPU PMU counters, if the NPU ran for this frame
+      if (npu_pmu_read(&npu_pmu_sample) != 0U) {
+        retv = sdsRecWrite(recIdNpuPmu, timestamp, &npu_pmu_sample, sizeof(npu_pmu_sample));
+        SDS_ASSERT(retv == sizeof(npu_pmu_sample));
+      }
+#endif
+      timeline_end(TIMELINE_RECORD);
+    }
+
+    timeline_frame_end();
+
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+    if ((sdsStreamingState == SDS_STREAMING_ACTIVE) || (sdsStreamingState == SDS_STREAMING_STOP)) {
+      // Record frame timeline
+      RecordTimeline(timestamp);
+    }
+#endif
+  }
+}
+
+#else
+
+// Capture Thread function
+static __NO_RETURN void CaptureThread (void *argument) {
+  sds_frame_slot_t *slot;
+  uint32_t idx;
+  uint32_t stop_sent = 0U;
+#ifndef SDS_PLAY
+  int32_t  retv;
+#endif
+  (void)argument;
+
+  // Initialize data acquisition (input data callbacks signal this thread)
+  InitInputData();
+
+  for (;;) {
+    if (sdsStreamingState == SDS_STREAMING_START) {
+      // Request to start streaming, transit to active state (synchronus to capture)
+      sdsStreamingState = SDS_STREAMING_ACTIVE;
+    }
+    if (sdsStreamingState == SDS_STREAMING_STOP) {
+      if (stop_sent == 0U) {
+        // Request to stop streaming, stop recording input data and let the Algorithm thread
+        // transit to state safe for stopping once all recorded frames were processed
+        idx = SDS_FRAME_SLOT_STOP;
+        osMessageQueuePut(frameFullQueue, &idx, 0U, osWaitForever);
+        stop_sent = 1U;
+      }
+    } else {
+      stop_sent = 0U;
+    }
+
+    // Wait for a free frame slot
+    osMessageQueueGet(frameFreeQueue, &idx, NULL, osWaitForever);
+    slot = &sds_frame_slot[idx];
+
+#if ENABLE_TIME_PROFILING
+    capture_time = profiler_start();
+#endif
+    slot->capture_begin = profiler_start();
+
+    // Get a block of input data as required by algorithm under test
+    if (GetInputData(slot->data_in, sizeof(slot->data_in)) != sizeof(slot->data_in)) {
+      // If there was an error retrieving data return the slot and skip algorithm execution
+      osMessageQueuePut(frameFreeQueue, &idx, 0U, 0U);
+      continue;
+    }
+
+#if ENABLE_TIME_PROFILING
+    capture_time = profiler_stop(capture_time);
+    LOG_MSG(LOG_CAPTURE_TIME, LOG_U(capture_time));
+    latency_hist_add(LATENCY_CAPTURE, capture_time);
+#endif
+
+    slot->record = 0U;
+    if ((stop_sent == 0U) &&
+        ((sdsStreamingState == SDS_STREAMING_ACTIVE) || (sdsStreamingState == SDS_STREAMING_STOP))) {
+#ifdef SDS_PLAY
+      // During playback, use the recorded timestamps for output data so that the output data timestamps
+      // exactly match those from the original recording
+      slot->timestamp = playTimestamp;
+#else
+      slot->timestamp = osKernelGetTickCount();
+
+      // Record algorithm input data
+      retv = sdsRecWrite(recIdDataInput, slot->timestamp, slot->data_in, sizeof(slot->data_in));
+      SDS_ASSERT(retv == sizeof(slot->data_in));
+#endif
+      slot->record = 1U;
+    }
+    slot->capture_end = profiler_start();
+
+    // Hand the slot over to the Algorithm thread (in capture order)
+    osMessageQueuePut(frameFullQueue, &idx, 0U, osWaitForever);
+  }
+}
+
+// Algorithm Thread function
+__NO_RETURN void AlgorithmThread (void *argument) {
+  sds_frame_slot_t *slot;
+  uint32_t idx;
+  int32_t  retv;
+  (void)argument;
+
+  // Initialize algorithm under test
+  InitAlgorithm();
+
+  // Create frame slot queues, all slots are free initially
+  frameFreeQueue = osMessageQueueNew(SDS_ALGO_FRAME_SLOTS,      sizeof(uint32_t), NULL);
+  frameFullQueue = osMessageQueueNew(SDS_ALGO_FRAME_SLOTS + 1U, sizeof(uint32_t), NULL);
+  SDS_ASSERT((frameFreeQueue != NULL) && (frameFullQueue != NULL));
+  for (idx = 0U; idx < SDS_ALGO_FRAME_SLOTS; idx++) {
+    osMessageQueuePut(frameFreeQueue, &idx, 0U, 0U);
+  }
+
+  // Create capture thread
+  osThreadNew(CaptureThread, NULL, &attrCaptureThread);
+
+#if ENABLE_TIME_PROFILING
+  total_usecase_time = profiler_start();
+#endif
+
+  for (;;) {
+    // Wait for a filled frame slot
+    osMessageQueueGet(frameFullQueue, &idx, NULL, osWaitForever);
+
+    if (idx == SDS_FRAME_SLOT_STOP) {
+      // All recorded frames were processed, transit to state safe for stopping
+      if (sdsStreamingState == SDS_STREAMING_STOP) {
+        sdsStreamingState = SDS_STREAMING_STOP_SAFE;
+      }
+      continue;
     }
+    slot = &sds_frame_slot[idx];
+
+    // Start the frame timeline with the capture done by the Capture thread
+    timeline_frame_begin();
+    timeline_set(TIMELINE_CAPTURE, slot->capture_begin, slot->capture_end);
+
+    /* Execute algorithm under test */
+    if (ExecuteAlgorithm(slot->data_in, sizeof(slot->data_in), slot->data_out, sizeof(slot->data_out)) == 0) {
+#if ENABLE_TIME_PROFILING
+      // Time between completed frames, capture of the next frame overlaps execution
+      total_usecase_time = profiler_stop(total_usecase_time);
+      LOG_MSG(LOG_TOTAL_TIME, LOG_U(total_usecase_time));
+      latency_hist_add(LATENCY_TOTAL, total_usecase_time);
+      total_usecase_time = profiler_start();
+#endif
+
+      if (slot->record != 0U) {
+        timeline_begin(TIMELINE_RECORD);
+
+        // Record algorithm output data
+        retv = sdsRecWrite(recIdDataOutput, slot->timestamp, slot->data_out, sizeof(slot->data_out));
+        SDS_ASSERT(retv == sizeof(slot->data_out));
+
+#if (NPU_PMU_ENABLE && NPU_PMU_SDS)
+        // Record NPU PMU counters, if the NPU ran for this frame
+        if (npu_pmu_read(&npu_pmu_sample) != 0U) {
+          retv = sdsRecWrite(recIdNpuPmu, slot->timestamp, &npu_pmu_sample, sizeof(npu_pmu_sample));
+          SDS_ASSERT(retv == sizeof(npu_pmu_sample));
+        }
+#endif
+        timeline_end(TIMELINE_RECORD);
+      }
+
+      timeline_frame_end();
+
+#if (TIMELINE_ENABLE && TIMELINE_SDS)
+      if (slot->record != 0U) {
+        // Record frame timeline
+        RecordTimeline(slot->timestamp);
+      }
+#endif
+    }
+
+    // Return the slot to the Capture thread
+    osMessageQueuePut(frameFreeQueue, &idx, 0U, osWaitForever);
   }
 }
+#endif
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include "cmsis_compiler.h"
 #include "sds_rec_play.h"
+#include "cpu_load.h"
 
 #ifdef  __cplusplus
 extern "C"
@@ -48,6 +49,13 @@ extern int32_t OpenStreams (void);
 */
 extern int32_t CloseStreams (void);
 
+/**
+  \fn           void RecordCpuLoad (const cpu_load_t *load)
+  \brief        Record the CPU load of a reporting interval while streaming is active.
+  \param[in]    load            CPU cycles of the interval
+*/
+extern void RecordCpuLoad (const cpu_load_t *load);
+
 // Algorithm Thread function
 extern __NO_RETURN void AlgorithmThread (void *argument);
 
@@ -0,0 +1,281 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Text rendering with a pre-rasterised glyph atlas.
+
+  text_font_init() converts every glyph row of the 8x8 bitmap font into
+  runs of set pixels at the requested scale. text_draw() then writes each
+  run of each scaled row with a single copy from a row of the text colour,
+  clipped against the clip rectangle, instead of testing each font bit and
+  sub-pixel for every character on every frame.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "text_render.h"
+
+#define FONT_MSB_MASK       0x80
+#define ASCII_CHAR_COUNT    128
+
+static const uint8_t font_8x8[ASCII_CHAR_COUNT][8] = {
+  /* Initialize first 32 entries (control characters) to blank */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 0 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 1 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 2 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 3 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 4 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 5 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 6 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 7 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 8 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 9 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 10 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 11 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 12 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 13 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 14 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 15 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 16 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 17 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 18 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 19 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 20 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 21 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 22 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 23 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 24 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 25 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 26 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 27 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 28 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 29 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 30 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 31 */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 32 ' ' (space) */
+  {0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x00}, /* 33 '!' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 34 '"' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 35 '#' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 36 '$' */
+  {0x62, 0x66, 0x0C, 0x18, 0x30, 0x66, 0x46, 0x00}, /* 37 '%' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 38 '&' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 39 ''' */
+  {0x0C, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00}, /* 40 '(' */
+  {0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00}, /* 41 ')' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 42 '*' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 43 '+' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 44 ',' */
+  {0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00}, /* 45 '-' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00}, /* 46 '.' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 47 '/' */
+  {0x3C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 48 '0' */
+  {0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00}, /* 49 '1' */
+  {0x3C, 0x66, 0x06, 0x0C, 0x18, 0x30, 0x7E, 0x00}, /* 50 '2' */
+  {0x3C, 0x66, 0x06, 0x1C, 0x06, 0x66, 0x3C, 0x00}, /* 51 '3' */
+  {0x0C, 0x1C, 0x2C, 0x4C, 0x7E, 0x0C, 0x0C, 0x00}, /* 52 '4' */
+  {0x7E, 0x60, 0x7C, 0x06, 0x06, 0x66, 0x3C, 0x00}, /* 53 '5' */
+  {0x3C, 0x60, 0x60, 0x7C, 0x66, 0x66, 0x3C, 0x00}, /* 54 '6' */
+  {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00}, /* 55 '7' */
+  {0x3C, 0x66, 0x66, 0x3C, 0x66, 0x66, 0x3C, 0x00}, /* 56 '8' */
+  {0x3C, 0x66, 0x66, 0x3E, 0x06, 0x0C, 0x38, 0x00}, /* 57 '9' */
+  {0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00}, /* 58 ':' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 59 ';' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 60 '<' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 61 '=' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 62 '>' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 63 '?' */
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* 64 '@' */
+  {0x18, 0x3C, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x00}, /* 65 'A' */
+  {0x7C, 0x66, 0x66, 0x7C, 0x66, 0x66, 0x7C, 0x00}, /* 66 'B' */
+  {0x3C, 0x66, 0x60, 0x60, 0x60, 0x66, 0x3C, 0x00}, /* 67 'C' */
+  {0x78, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0x78, 0x00}, /* 68 'D' */
+  {0x7E, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x7E, 0x00}, /* 69 'E' */
+  {0x7E, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x60, 0x00}, /* 70 'F' */
+  {0x3C, 0x66, 0x60, 0x6E, 0x66, 0x66, 0x3C, 0x00}, /* 71 'G' */
+  {0x66, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x66, 0x00}, /* 72 'H' */
+  {0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00}, /* 73 'I' */
+  {0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x3C, 0x00}, /* 74 'J' */
+  {0x66, 0x6C, 0x78, 0x70, 0x78, 0x6C, 0x66, 0x00}, /* 75 'K' */
+  {0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x00}, /* 76 'L' */
+  {0x63, 0x77, 0x7F, 0x6B, 0x63, 0x63, 0x63, 0x00}, /* 77 'M' */
+  {0x66, 0x76, 0x7E, 0x7E, 0x6E, 0x66, 0x66, 0x00}, /* 78 'N' */
+  {0x3C, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 79 'O' */
+  {0x7C, 0x66, 0x66, 0x7C, 0x60, 0x60, 0x60, 0x00}, /* 80 'P' */
+  {0x3C, 0x66, 0x66, 0x66, 0x6A, 0x6C, 0x36, 0x00}, /* 81 'Q' */
+  {0x7C, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0x66, 0x00}, /* 82 'R' */
+  {0x3C, 0x66, 0x60, 0x3C, 0x06, 0x66, 0x3C, 0x00}, /* 83 'S' */
+  {0x7E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00}, /* 84 'T' */
+  {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x00}, /* 85 'U' */
+  {0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x18, 0x00}, /* 86 'V' */
+  {0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00}, /* 87 'W' */
+  {0x66, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0x66, 0x00}, /* 88 'X' */
+  {0x66, 0x66, 0x66, 0x3C, 0x18, 0x18, 0x18, 0x00}, /* 89 'Y' */
+  {0x7E, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x7E, 0x00}}; /* 90 'Z' */
+
+/* Atlas index of a character, -1 when it has no glyph (drawn as space) */
+static int glyph_index(char c) {
+  if ((c >= 'a') && (c <= 'z')) {
+    c = (char)(c - 'a' + 'A');
+  }
+  if (((uint8_t)c < TEXT_FIRST_CHAR) || ((uint8_t)c >= (TEXT_FIRST_CHAR + TEXT_CHAR_COUNT))) {
+    return -1;
+  }
+  return (uint8_t)c - TEXT_FIRST_CHAR;
+}
+
+int text_font_init(text_font_t *font, int scale) {
+  if ((scale < 1) || (scale > TEXT_MAX_SCALE)) {
+    return -1;
+  }
+
+  font->scale       = scale;
+  font->char_width  = TEXT_FONT_WIDTH  * scale;
+  font->char_height = TEXT_FONT_HEIGHT * scale;
+  font->line_height = (TEXT_FONT_HEIGHT + 2) * scale;
+
+  for (int g = 0; g < TEXT_CHAR_COUNT; ++g) {
+    const uint8_t *glyph = font_8x8[TEXT_FIRST_CHAR + g];
+
+    for (int row = 0; row < TEXT_FONT_HEIGHT; ++row) {
+      int n   = 0;
+      int col = 0;
+
+      /* Runs of set bits, MSB is the leftmost pixel; 8 bits hold at most 4 runs */
+      while (col < TEXT_FONT_WIDTH) {
+        if ((glyph[row] & (FONT_MSB_MASK >> col)) == 0) {
+          col++;
+          continue;
+        }
+        int start = col;
+        while ((col < TEXT_FONT_WIDTH) && (glyph[row] & (FONT_MSB_MASK >> col))) {
+          col++;
+        }
+        font->span[g][row][n].x   = (uint8_t)(start * scale);
+        font->span[g][row][n].len = (uint8_t)((col - start) * scale);
+        n++;
+      }
+      font->count[g][row] = (uint8_t)n;
+    }
+  }
+
+  return 0;
+}
+
+void text_measure(const text_font_t *font, const char *text, int *width, int *height) {
+  int max_len = 0;
+  int len     = 0;
+  int lines   = 1;
+
+  for (; *text != '\0'; ++text) {
+    if (*text == '\n') {
+      lines++;
+      len = 0;
+    } else if (++len > max_len) {
+      max_len = len;
+    }
+  }
+
+  if (width != NULL) {
+    *width = max_len * font->char_width;
+  }
+  if (height != NULL) {
+    *height = ((lines - 1) * font->line_height) + font->char_height;
+  }
+}
+
+void text_draw(const text_font_t *font,
+               uint8_t *image,
+               int width,
+               int height,
+               const text_rect_t *clip,
+               int x,
+               int y,
+               const char *text,
+               const uint8_t color[3]) {
+  uint8_t color_row[TEXT_FONT_WIDTH * TEXT_MAX_SCALE * 3];
+  int     x0 = 0;
+  int     y0 = 0;
+  int     x1 = width;
+  int     y1 = height;
+  int     cx = x;
+
+  /* Clip window: clip rectangle within the image */
+  if (clip != NULL) {
+    if (clip->x > x0)                 { x0 = clip->x; }
+    if (clip->y > y0)                 { y0 = clip->y; }
+    if (clip->x + clip->width  < x1)  { x1 = clip->x + clip->width;  }
+    if (clip->y + clip->height < y1)  { y1 = clip->y + clip->height; }
+  }
+  if ((x0 >= x1) || (y0 >= y1)) {
+    return;
+  }
+
+  /* One glyph row of the text colour, source of all run copies */
+  for (int i = 0; i < font->char_width; ++i) {
+    color_row[i * 3 + 0] = color[0];
+    color_row[i * 3 + 1] = color[1];
+    color_row[i * 3 + 2] = color[2];
+  }
+
+  for (; *text != '\0'; ++text) {
+    int g;
+
+    if (*text == '\n') {
+      cx  = x;
+      y  += font->line_height;
+      continue;
+    }
+
+    g   = glyph_index(*text);
+    cx += font->char_width;
+
+    /* Skip blank and fully clipped characters */
+    if ((g < 0) || (cx <= x0) || (cx - font->char_width >= x1) ||
+        (y + font->char_height <= y0) || (y >= y1)) {
+      continue;
+    }
+
+    for (int row = 0; row < TEXT_FONT_HEIGHT; ++row) {
+      const text_span_t *span = font->span[g][row];
+      const int          n    = font->count[g][row];
+
+      for (int sy = 0; sy < font->scale; ++sy) {
+        int py = y + (row * font->scale) + sy;
+
+        if ((py < y0) || (py >= y1)) {
+          continue;
+        }
+
+        uint8_t *dst = &image[py * width * 3];
+
+        for (int s = 0; s < n; ++s) {
+          int px0 = cx - font->char_width + span[s].x;
+          int px1 = px0 + span[s].len;
+
+          if (px0 < x0) { px0 = x0; }
+          if (px1 > x1) { px1 = x1; }
+          if (px0 < px1) {
+            memcpy(&dst[px0 * 3], color_row, (size_t)(px1 - px0) * 3U);
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,125 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef TEXT_RENDER_H__
+#define TEXT_RENDER_H__
+
+#include <stdint.h>
+
+/* Font cell size in pixels (unscaled) */
+#define TEXT_FONT_WIDTH     8
+#define TEXT_FONT_HEIGHT    8
+
+/* Characters held in a glyph atlas (printable ASCII) */
+#define TEXT_FIRST_CHAR     32
+#define TEXT_CHAR_COUNT     96
+
+/* Maximum number of pixel runs in one glyph row */
+#define TEXT_MAX_SPANS      4
+
+/* Maximum font scale */
+#ifndef TEXT_MAX_SCALE
+#define TEXT_MAX_SCALE      4
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Horizontal run of set pixels in a scaled glyph row
+typedef struct {
+  uint8_t x;                    ///< First column, relative to the glyph origin
+  uint8_t len;                  ///< Number of pixels
+} text_span_t;
+
+/**
+ * @brief Glyph atlas of the 8x8 font at one scale.
+ *
+ * Each glyph row is stored as a list of scaled pixel runs, so drawing a
+ * character copies a few runs per row instead of testing every font bit
+ * and sub-pixel. Build it once with @ref text_font_init.
+ */
+typedef struct {
+  int         scale;                                                    ///< Font scale
+  int         char_width;                                               ///< Character advance in pixels
+  int         char_height;                                              ///< Character height in pixels
+  int         line_height;                                              ///< Line advance in pixels
+  uint8_t     count[TEXT_CHAR_COUNT][TEXT_FONT_HEIGHT];                 ///< Runs per glyph row
+  text_span_t span [TEXT_CHAR_COUNT][TEXT_FONT_HEIGHT][TEXT_MAX_SPANS]; ///< Runs of each glyph row
+} text_font_t;
+
+/// Rectangle in pixels
+typedef struct {
+  int x;                        ///< Left column
+  int y;                        ///< Top row
+  int width;                    ///< Width
+  int height;                   ///< Height
+} text_rect_t;
+
+/**
+ * @brief Build the glyph atlas of the 8x8 font at the given scale.
+ *
+ * @param[out] font   Glyph atlas.
+ * @param[in]  scale  Font scale (1 .. TEXT_MAX_SCALE).
+ * @return 0 on success, -1 on invalid scale.
+ */
+int text_font_init(text_font_t *font, int scale);
+
+/**
+ * @brief Measure a text.
+ *
+ * @param[in]  font    Glyph atlas.
+ * @param[in]  text    Null-terminated text, '\n' starts a new line.
+ * @param[out] width   Width of the longest line in pixels (may be NULL).
+ * @param[out] height  Height of all lines in pixels (may be NULL).
+ */
+void text_measure(const text_font_t *font, const char *text, int *width, int *height);
+
+/**
+ * @brief Draw a text into an RGB888 image.
+ *
+ * Set font pixels are written in the given colour, other pixels are left
+ * unchanged. Lower case characters are drawn as upper case and characters
+ * outside of the atlas as space. Drawing is clipped to the clip rectangle
+ * and to the image.
+ *
+ * @param[in]     font    Glyph atlas.
+ * @param[in,out] image   Pointer to the image (RGB888).
+ * @param[in]     width   Image width in pixels.
+ * @param[in]     height  Image height in pixels.
+ * @param[in]     clip    Clip rectangle, or NULL to clip to the image only.
+ * @param[in]     x       Left column of the first character.
+ * @param[in]     y       Top row of the first line.
+ * @param[in]     text    Null-terminated text, '\n' starts a new line at column x.
+ * @param[in]     color   Text colour (R, G, B).
+ */
+void text_draw(const text_font_t *font,
+               uint8_t *image,
+               int width,
+               int height,
+               const text_rect_t *clip,
+               int x,
+               int y,
+               const char *text,
+               const uint8_t color[3]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEXT_RENDER_H__ */
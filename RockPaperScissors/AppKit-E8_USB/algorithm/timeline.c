@@ -0,0 +1,132 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+/*
+  Stage timeline recorder.
+
+  The algorithm thread marks the begin and end of each pipeline stage of a
+  frame with the DWT cycle counter. Completed frames are kept in a ring of
+  TIMELINE_RING_SIZE records, from which they are read for SDS recording.
+  All functions are called from the algorithm thread, so no locking is used.
+*/
+
+#include <string.h>
+
+#include "timeline.h"
+
+static const char *const timeline_stage_names[TIMELINE_NUM_STAGES] = {
+  "capture",
+  "preprocess",
+  "quantize",
+  "npu",
+  "dequantize",
+  "postprocess",
+  "blit",
+  "record"
+};
+
+#if TIMELINE_ENABLE
+
+#define TIMELINE_RING_MASK  (TIMELINE_RING_SIZE - 1U)
+
+timeline_record_t        timeline_frame;
+
+static timeline_record_t timeline_ring[TIMELINE_RING_SIZE];
+static uint32_t          timeline_head;         /* Records written */
+static uint32_t          timeline_tail;         /* Records read */
+static uint32_t          timeline_frames;       /* Frame number */
+
+/* Start the timeline of a new frame */
+void timeline_frame_begin (void) {
+  timeline_frame.frame  = timeline_frames++;
+  timeline_frame.stages = 0U;
+}
+
+/* Set a stage of the frame in progress measured elsewhere */
+void timeline_set (timeline_stage_t stage, uint32_t begin, uint32_t end) {
+  timeline_frame.stage[stage].begin = begin;
+  timeline_frame.stage[stage].end   = end;
+  timeline_frame.stages |= (1UL << stage);
+}
+
+/* Complete the timeline of the frame in progress and store it in the ring */
+void timeline_frame_end (void) {
+  uint32_t i;
+
+  /* Clear stamps of stages not run in this frame */
+  for (i = 0U; i < TIMELINE_NUM_STAGES; i++) {
+    if ((timeline_frame.stages & (1UL << i)) == 0U) {
+      timeline_frame.stage[i].begin = 0U;
+      timeline_frame.stage[i].end   = 0U;
+    }
+  }
+
+  if ((timeline_head - timeline_tail) == TIMELINE_RING_SIZE) {
+    /* Ring full: drop the oldest record */
+    timeline_tail++;
+  }
+  memcpy(&timeline_ring[timeline_head & TIMELINE_RING_MASK], &timeline_frame, sizeof(timeline_record_t));
+  timeline_head++;
+}
+
+/* Read the oldest frame record from the ring */
+uint32_t timeline_read (timeline_record_t *rec) {
+  if (timeline_tail == timeline_head) {
+    return 0U;
+  }
+  memcpy(rec, &timeline_ring[timeline_tail & TIMELINE_RING_MASK], sizeof(timeline_record_t));
+  timeline_tail++;
+  return 1U;
+}
+
+/* Discard all frame records of the ring */
+void timeline_reset (void) {
+  timeline_tail = timeline_head;
+}
+
+#else
+
+void timeline_frame_begin (void) {
+}
+
+void timeline_set (timeline_stage_t stage, uint32_t begin, uint32_t end) {
+  (void)stage;
+  (void)begin;
+  (void)end;
+}
+
+void timeline_frame_end (void) {
+}
+
+uint32_t timeline_read (timeline_record_t *rec) {
+  (void)rec;
+  return 0U;
+}
+
+void timeline_reset (void) {
+}
+
+#endif
+
+/* Get the name of a pipeline stage */
+const char *timeline_stage_name (timeline_stage_t stage) {
+  if ((uint32_t)stage >= TIMELINE_NUM_STAGES) {
+    return "";
+  }
+  return timeline_stage_names[stage];
+}
@@ -0,0 +1,147 @@
+/*---------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *---------------------------------------------------------------------------*/
+
+#ifndef TIMELINE_H__
+#define TIMELINE_H__
+
+#include <stdint.h>
+
+#include "profiler.h"
+
+/* Record the begin and end cycle stamps of the pipeline stages of every frame (0: disabled) */
+#ifndef TIMELINE_ENABLE
+#define TIMELINE_ENABLE     0
+#endif
+
+/* Record the frame timelines to the SDS stream "Timing" (Timing.sds.yml) */
+#ifndef TIMELINE_SDS
+#define TIMELINE_SDS        1
+#endif
+
+/* Number of frame records kept in the timeline ring, power of two */
+#ifndef TIMELINE_RING_SIZE
+#define TIMELINE_RING_SIZE  16U
+#endif
+
+#if (TIMELINE_RING_SIZE & (TIMELINE_RING_SIZE - 1U)) != 0U
+#error "TIMELINE_RING_SIZE must be a power of two"
+#endif
+
+/* Pipeline stages of a frame */
+typedef enum {
+  TIMELINE_CAPTURE = 0,                 /* Frame acquisition, with the SDS write of the input data when recording */
+  TIMELINE_PREPROCESS,                  /* Conversion of the frame into the model input */
+  TIMELINE_QUANTIZE,                    /* CPU operators up to the start of the NPU job */
+  TIMELINE_NPU,                         /* NPU job, from start until collected */
+  TIMELINE_DEQUANTIZE,                  /* CPU operators after the NPU job */
+  TIMELINE_POSTPROCESS,                 /* Decoding of the model output */
+  TIMELINE_BLIT,                        /* Copy of the ML image and overlay to the frame buffer */
+  TIMELINE_RECORD,                      /* SDS write of the output data */
+  TIMELINE_NUM_STAGES
+} timeline_stage_t;
+
+/* Timeline of one frame */
+typedef struct {
+  uint32_t frame;                       /* Frame number */
+  uint32_t stages;                      /* Recorded stages, bit n set for stage n */
+  struct {
+    uint32_t begin;                     /* Cycle counter at stage begin */
+    uint32_t end;                       /* Cycle counter at stage end */
+  } stage[TIMELINE_NUM_STAGES];
+} timeline_record_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if TIMELINE_ENABLE
+
+/* Timeline of the frame in progress */
+extern timeline_record_t timeline_frame;
+
+/* Mark the begin of a stage of the frame in progress */
+static inline void timeline_begin(timeline_stage_t stage) {
+  timeline_frame.stage[stage].begin = profiler_start();
+}
+
+/* Mark the end of a stage of the frame in progress */
+static inline void timeline_end(timeline_stage_t stage) {
+  timeline_frame.stage[stage].end = profiler_start();
+  timeline_frame.stages |= (1UL << stage);
+}
+
+#else
+
+static inline void timeline_begin(timeline_stage_t stage) { (void)stage; }
+static inline void timeline_end  (timeline_stage_t stage) { (void)stage; }
+
+#endif
+
+/**
+ * @brief Start the timeline of a new frame.
+ *
+ * Discards the stages of an unfinished frame. Stage begin/end marks are
+ * stored into the timeline of this frame until timeline_frame_end().
+ * Call from the thread running the algorithm.
+ */
+void timeline_frame_begin(void);
+
+/**
+ * @brief Set a stage of the frame in progress measured elsewhere.
+ *
+ * Used for stages run by another thread, e.g. capture in the Capture thread.
+ *
+ * @param[in] stage  Pipeline stage.
+ * @param[in] begin  Cycle counter at stage begin.
+ * @param[in] end    Cycle counter at stage end.
+ */
+void timeline_set(timeline_stage_t stage, uint32_t begin, uint32_t end);
+
+/**
+ * @brief Complete the timeline of the frame in progress and store it in the ring.
+ *
+ * When the ring is full the oldest record is overwritten.
+ */
+void timeline_frame_end(void);
+
+/**
+ * @brief Read the oldest frame record from the ring.
+ *
+ * @param[out] rec  Frame record.
+ * @return 1 if a record was read, 0 if the ring is empty.
+ */
+uint32_t timeline_read(timeline_record_t *rec);
+
+/**
+ * @brief Discard all frame records of the ring.
+ */
+void timeline_reset(void);
+
+/**
+ * @brief Get the name of a pipeline stage.
+ *
+ * @param[in] stage  Pipeline stage.
+ * @return Stage name, e.g. "capture".
+ */
+const char *timeline_stage_name(timeline_stage_t stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_H__ */
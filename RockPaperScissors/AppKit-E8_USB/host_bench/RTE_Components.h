@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Host replacement of the RTE_Components.h of the AlgorithmTest project for the host_bench runner build */
+
+#ifndef HOST_RTE_COMPONENTS_H
+#define HOST_RTE_COMPONENTS_H
+
+/* Device header: only the compiler definitions are needed on the host */
+#define CMSIS_device_header     "cmsis_compiler.h"
+
+/* ExecuTorch operators of the model: the quantize and dequantize operator components are selected */
+#define RTE_ML_EXECUTORCH_OP_QUANTIZED_QUANTIZE
+#define RTE_ML_EXECUTORCH_OP_QUANTIZED_DEQUANTIZE
+
+#endif /* HOST_RTE_COMPONENTS_H */
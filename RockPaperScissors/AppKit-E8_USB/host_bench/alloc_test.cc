@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host test: the runner does not allocate heap memory after initialization.
+
+  Built like the host_bench runner build (stub model and drivers, see
+  README.md), with arm_executor_runner.cc included here to reach its
+  internal state. The C library allocation functions are wrapped with the
+  linker (--wrap) and the C++ allocation operators are replaced so that
+  every heap allocation is counted.
+
+  After InitAlgorithm() the input and output value lists of the runner are
+  checked against the MethodMeta of the model, then frames are run through
+  preprocess(), run_inference() and postprocess() and through
+  ExecuteAlgorithm(), expecting no heap allocation, no growth of the method
+  allocator and unchanged value lists. Finally an inference is abandoned
+  with its NPU job pending, as after a failed step, and the reloaded method
+  is expected to run further frames without growing the method allocator.
+  Built with ML_MAX_MODELS=2, two models are loaded as well, expecting the
+  second one to add neither a planned-memory nor an Ethos-U scratch arena.
+
+  Returns 0 when all checks pass.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "arm_executor_runner.cc"
+#include "model_pte.h"
+#include "sds_algorithm.h"
+#include "sds_algorithm_config.h"
+
+/* Number of frames run through each path */
+#define TEST_FRAMES  16
+
+/* Heap allocations counted by the wrappers */
+static volatile uint32_t heap_allocs = 0U;
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t num, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    heap_allocs = heap_allocs + 1U;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t num, size_t size) {
+    heap_allocs = heap_allocs + 1U;
+    return __real_calloc(num, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    heap_allocs = heap_allocs + 1U;
+    return __real_realloc(ptr, size);
+}
+}
+
+/* C++ allocations go through the wrapped malloc() */
+void* operator new(size_t size) {
+    void* ptr = malloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return malloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+/* Number of failed checks */
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) {
+        failures++;
+    }
+}
+
+/* Input image of a frame, changes with the frame number */
+static void make_image(uint8_t* image, uint32_t frame) {
+    for (uint32_t i = 0U; i < (uint32_t)(IMAGE_HEIGHT * IMAGE_WIDTH * 3); i++) {
+        image[i] = (uint8_t)((i % 3U) == (frame % 3U) ? 200U + frame : i / 997U);
+    }
+}
+
+/* allocate_evalues(): n default values from the allocator, empty if it is exhausted */
+static void test_allocate_evalues(void) {
+    alignas(16) static uint8_t pool[4 * sizeof(EValue)];
+    MemoryAllocator allocator(sizeof(pool), pool);
+
+    check(allocate_evalues(allocator, 0).size() == 0,
+          "allocate_evalues() returns no values for n = 0");
+
+    Span<EValue> values = allocate_evalues(allocator, 3);
+    bool none = (values.size() == 3);
+    for (size_t i = 0; none && (i < values.size()); i++) {
+        none = values[i].isNone();
+    }
+    check(none, "allocate_evalues() returns n default constructed values");
+    check((reinterpret_cast<uint8_t*>(values.data()) >= pool) &&
+              (reinterpret_cast<uint8_t*>(values.data() + values.size()) <=
+               pool + sizeof(pool)),
+          "allocate_evalues() takes the values from the allocator");
+    check(allocate_evalues(allocator, 2).size() == 0,
+          "allocate_evalues() returns no values when the allocator is exhausted");
+}
+
+/* Value lists of the runner context, sized from the MethodMeta at init */
+static void test_value_lists(RunnerContext& ctx) {
+    MethodMeta meta = ctx.method.value()->method_meta();
+    const uint8_t* pool_end = method_allocation_pool + method_allocation_pool_size;
+
+    check(ctx.inputs.size() == meta.num_inputs(),
+          "input value list holds MethodMeta::num_inputs() values");
+    check(ctx.outputs.size() == meta.num_outputs(),
+          "output value list holds MethodMeta::num_outputs() values");
+    check((reinterpret_cast<uint8_t*>(ctx.inputs.data()) >= method_allocation_pool) &&
+              (reinterpret_cast<uint8_t*>(ctx.outputs.data() + ctx.outputs.size()) <= pool_end),
+          "value lists are allocated from the method allocator pool");
+}
+
+/* Frames after init: no heap allocation, no method allocator growth, same value lists */
+static void test_frames(RunnerContext& ctx) {
+    static uint8_t image[IMAGE_HEIGHT * IMAGE_WIDTH * 3];
+    static uint8_t out_buf[SDS_ALGO_DATA_OUT_BLOCK_SIZE];
+    const EValue* inputs = ctx.inputs.data();
+    const EValue* outputs = ctx.outputs.data();
+    const size_t method_used = ctx.method_allocator->used_size();
+    bool ok = true;
+
+    heap_allocs = 0U;
+
+    for (uint32_t frame = 0U; (frame < TEST_FRAMES) && ok; frame++) {
+        make_image(image, frame);
+        preprocess(image);
+        ok = run_inference(ctx);
+        postprocess(ctx, out_buf, sizeof(out_buf));
+    }
+    check(ok, "preprocess(), run_inference() and postprocess() succeed");
+    printf("Heap allocations in %u frames: %u\n", TEST_FRAMES,
+           (unsigned int)heap_allocs);
+    check(heap_allocs == 0U,
+          "preprocess(), run_inference() and postprocess() do not allocate heap memory");
+
+    heap_allocs = 0U;
+
+    for (uint32_t frame = 0U; (frame < TEST_FRAMES) && ok; frame++) {
+        make_image(image, frame);
+        ok = (ExecuteAlgorithm(image, sizeof(image), out_buf, sizeof(out_buf)) == 0);
+    }
+    check(ok, "ExecuteAlgorithm() succeeds");
+    printf("Heap allocations in %u frames: %u\n", TEST_FRAMES,
+           (unsigned int)heap_allocs);
+    check(heap_allocs == 0U, "ExecuteAlgorithm() does not allocate heap memory");
+
+    check(ctx.method_allocator->used_size() == method_used,
+          "method allocator does not grow after init");
+    check((ctx.inputs.data() == inputs) && (ctx.outputs.data() == outputs),
+          "value lists are reused by every frame");
+}
+
+/* Inference abandoned part way through: the method is reloaded in place */
+static void test_recovery(RunnerContext& ctx) {
+    static uint8_t image[IMAGE_HEIGHT * IMAGE_WIDTH * 3];
+    static uint8_t out_buf[SDS_ALGO_DATA_OUT_BLOCK_SIZE];
+    const size_t method_used = ctx.method_allocator->used_size();
+    const void* method_end = ctx.method_allocator->allocate(0U, 1U);
+
+    make_image(image, 0U);
+    preprocess(image);
+    bool ok = run_inference_start(ctx);
+    check(ok && (EthosUBackend_async_pending() != 0),
+          "run_inference_start() leaves the NPU job pending");
+    check(EthosUBackend_request_async() != 0,
+          "a second async request is rejected while a job is pending");
+
+    /* As after a failed step: the method is left part way through */
+    abort_inference(ctx);
+    check(EthosUBackend_async_pending() == 0, "abort_inference() collects the NPU job");
+
+    heap_allocs = 0U;
+    for (uint32_t frame = 0U; (frame < TEST_FRAMES) && ok; frame++) {
+        make_image(image, frame);
+        preprocess(image);
+        ok = run_inference(ctx);
+        postprocess(ctx, out_buf, sizeof(out_buf));
+    }
+    check(ok, "inference succeeds after the method is reloaded");
+    check(heap_allocs == 0U, "reloading the method does not allocate heap memory");
+    check((ctx.method_allocator->used_size() == method_used) &&
+              (ctx.method_allocator->allocate(0U, 1U) == method_end),
+          "reloading the method does not grow the method allocator");
+}
+
+#if ML_MAX_MODELS >= 2
+/* Two models share the planned-memory and Ethos-U scratch arenas */
+static void test_two_models(void) {
+    static uint8_t image[IMAGE_HEIGHT * IMAGE_WIDTH * 3];
+    static uint8_t out_buf[SDS_ALGO_DATA_OUT_BLOCK_SIZE];
+    static BufferDataLoader loader(model_pte, sizeof(model_pte));
+    static Result<Program> program = Program::load(&loader);
+    runner_model_t models[2];
+
+    if (!program.ok()) {
+        check(false, "stub model program loads");
+        return;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        models[i].program = &program.get();
+        models[i].pte = model_pte;
+        models[i].pte_size = sizeof(model_pte);
+        models[i].config = RPS_MODEL;
+    }
+
+    runner_init_models(models, 1);
+    const size_t used_one = shared_method_allocator->used_size();
+    runner_init_models(models, 2);
+    const size_t used_two = shared_method_allocator->used_size();
+
+    printf("Method allocator: %u bytes with 1 model, %u bytes with 2 models\n",
+           (unsigned int)used_one, (unsigned int)used_two);
+    printf("Planned-memory arena: %u bytes, Ethos-U scratch arena: %u bytes\n",
+           (unsigned int)planned_arena_size, (unsigned int)scratch_arena_size);
+    check(scratch_arena_size == EthosUBackend_scratch_size(),
+          "Ethos-U scratch arena is sized for the largest delegate");
+    check((used_two - used_one) < planned_arena_size,
+          "a second model does not add a planned-memory arena");
+    check((used_two - used_one) < scratch_arena_size,
+          "a second model does not add an Ethos-U scratch");
+
+    bool ok = true;
+    for (uint32_t frame = 0U; (frame < TEST_FRAMES) && ok; frame++) {
+        RunnerContext* ctx = runner_select_model(frame % 2U);
+        make_image(image, frame);
+        preprocess(image);
+        ok = (ctx != nullptr) && run_inference(*ctx);
+        if (ok) {
+            postprocess(*ctx, out_buf, sizeof(out_buf));
+        }
+    }
+    check(ok, "inference succeeds when switching between two models");
+}
+#endif
+
+int main(void) {
+    test_allocate_evalues();
+
+    if ((host_model_build() != 0) || (InitAlgorithm() != 0)) {
+        printf("FAIL: initialization\n");
+        return 1;
+    }
+
+    test_value_lists(*runner_context_instance());
+    test_frames(*runner_context_instance());
+    test_recovery(*runner_context_instance());
+#if ML_MAX_MODELS >= 2
+    test_two_models();
+#endif
+
+    printf("%s: %d check(s) failed\n", (failures == 0) ? "PASS" : "FAIL", failures);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Minimal host replacement of CMSIS cmsis_compiler.h for host_bench (GCC/Clang) */
+
+#ifndef HOST_CMSIS_COMPILER_H
+#define HOST_CMSIS_COMPILER_H
+
+#ifndef __WEAK
+#define __WEAK                  __attribute__((weak))
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE         static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE    __attribute__((always_inline)) static inline
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN             __attribute__((__noreturn__))
+#endif
+#ifndef __REV
+#define __REV(value)            __builtin_bswap32(value)
+#endif
+#ifndef __UNALIGNED_UINT32_READ
+#define __UNALIGNED_UINT32_READ(addr)         host_unaligned_read32(addr)
+#define __UNALIGNED_UINT32_WRITE(addr, val)   host_unaligned_write32((addr), (val))
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+static inline uint32_t host_unaligned_read32(const void *addr) {
+  uint32_t value;
+  memcpy(&value, addr, sizeof(value));
+  return value;
+}
+
+static inline void host_unaligned_write32(void *addr, uint32_t value) {
+  memcpy(addr, &value, sizeof(value));
+}
+
+#endif /* HOST_CMSIS_COMPILER_H */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Minimal host replacement of CMSIS cmsis_vstream.h for host_bench: the parts used by the application */
+
+#ifndef HOST_CMSIS_VSTREAM_H
+#define HOST_CMSIS_VSTREAM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status and error codes */
+#define VSTREAM_OK                  0
+#define VSTREAM_ERROR              -1
+#define VSTREAM_ERROR_BUSY         -2
+#define VSTREAM_ERROR_TIMEOUT      -3
+#define VSTREAM_ERROR_UNSUPPORTED  -4
+#define VSTREAM_ERROR_PARAMETER    -5
+
+/* Streaming modes */
+#define VSTREAM_MODE_CONTINUOUS     0U
+#define VSTREAM_MODE_SINGLE         1U
+
+/* Events */
+#define VSTREAM_EVENT_DATA          (1UL << 0)
+#define VSTREAM_EVENT_OVERFLOW      (1UL << 1)
+#define VSTREAM_EVENT_UNDERFLOW     (1UL << 2)
+#define VSTREAM_EVENT_EOS           (1UL << 3)
+
+/* Stream status */
+typedef struct {
+  uint32_t active    :  1;
+  uint32_t overflow  :  1;
+  uint32_t underflow :  1;
+  uint32_t eos       :  1;
+  uint32_t reserved  : 28;
+} vStreamStatus_t;
+
+/* Event callback */
+typedef void (*vStreamEvent_t)(uint32_t event);
+
+/* Stream driver access structure */
+typedef struct {
+  int32_t         (*Initialize)   (vStreamEvent_t event_cb);
+  int32_t         (*Uninitialize) (void);
+  int32_t         (*SetBuf)       (void *buf, uint32_t buf_size, uint32_t block_size);
+  int32_t         (*Start)        (uint32_t mode);
+  int32_t         (*Stop)         (void);
+  void *          (*GetBlock)     (void);
+  int32_t         (*ReleaseBlock) (void);
+  vStreamStatus_t (*GetStatus)    (void);
+} vStreamDriver_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_CMSIS_VSTREAM_H */
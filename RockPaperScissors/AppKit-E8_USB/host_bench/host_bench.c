@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host benchmark of the CPU-side image stages of the AlgorithmTest pipeline.
+
+  Builds the application image processing sources with the application
+  configuration headers (config_video.h, app_setup.h) and times each stage
+  over a set of frames. Frames are read from SDS recordings (ML_In.<n>.sds)
+  or binary PPM images (for example converted from RPS_cls_dataset) and are
+  scaled up to the configured camera frame to feed the capture stages.
+
+  With HOST_BENCH_RUNNER defined, the ExecuTorch runner and the algorithm
+  (arm_executor_runner.cc, sds_algorithm_user.cpp) are built as well, with
+  stub Ethos-U and vStream VideoOut drivers and a stub model, and the
+  pre-processing, inference, post-processing and complete algorithm frame
+  are timed too.
+
+  See README.md for build and usage.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "app_setup.h"
+#include "config_buf.h"
+#include "image_processing_func.h"
+#include "display_overlay.h"
+#include "motion_gate.h"
+#ifdef HOST_BENCH_RUNNER
+#include "sds_algorithm.h"
+#include "sds_algorithm_config.h"
+#include "host_pipeline.h"
+#endif
+
+/* Maximum number of input frames kept in memory */
+#define MAX_FRAMES      64
+
+/* Maximum number of timed iterations per stage */
+#define MAX_ITERATIONS  10000
+
+/* Input frame (RGB888) and the camera frames derived from it */
+typedef struct {
+  uint8_t *data;
+  int      width;
+  int      height;
+  uint8_t *rgb565;              /* Camera frame, RGB565           */
+  uint8_t *raw8;                /* Camera frame, RAW8 Bayer       */
+} frame_t;
+
+/* Benchmark stage */
+typedef struct {
+  const char *name;
+  void      (*run)(const frame_t *frame);
+} stage_t;
+
+static frame_t  frames[MAX_FRAMES];
+static int      frame_num;
+
+/* Stage buffers */
+static uint8_t  ml_image  [ML_IMAGE_SIZE];
+static uint8_t  lcd_frame [DISPLAY_IMAGE_SIZE];
+
+static image_resize_plan_t plan_nearest;
+static image_resize_plan_t plan_bilinear;
+static image_resize_plan_t plan_area;
+
+#ifdef HOST_BENCH_RUNNER
+static uint8_t  algo_out  [SDS_ALGO_DATA_OUT_BLOCK_SIZE];
+#endif
+
+static uint64_t samples[MAX_ITERATIONS];
+
+/* Start of the timed region, a stage may move it past its own setup */
+static uint64_t time_start;
+
+/* Monotonic time in nanoseconds */
+static uint64_t time_ns(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+static int compare_u64(const void *a, const void *b) {
+  uint64_t va = *(const uint64_t *)a;
+  uint64_t vb = *(const uint64_t *)b;
+
+  return (va > vb) - (va < vb);
+}
+
+/* Read next whitespace separated PPM header value, skipping comments */
+static int ppm_value(FILE *f) {
+  int c;
+  int v = 0;
+
+  do {
+    c = fgetc(f);
+    if (c == '#') {
+      while ((c != '\n') && (c != EOF)) {
+        c = fgetc(f);
+      }
+    }
+  } while ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+
+  while ((c >= '0') && (c <= '9')) {
+    v = (v * 10) + (c - '0');
+    c = fgetc(f);
+  }
+  return v;
+}
+
+/* Load binary PPM (P6, 8-bit) image */
+static int load_ppm(const char *name) {
+  FILE    *f = fopen(name, "rb");
+  frame_t *fr;
+  size_t   size;
+
+  if (f == NULL) {
+    return -1;
+  }
+  if ((fgetc(f) != 'P') || (fgetc(f) != '6') || (frame_num >= MAX_FRAMES)) {
+    fclose(f);
+    return -1;
+  }
+  fr         = &frames[frame_num];
+  fr->width  = ppm_value(f);
+  fr->height = ppm_value(f);
+  if ((ppm_value(f) != 255) || (fr->width < 2) || (fr->height < 2)) {
+    fclose(f);
+    return -1;
+  }
+  size     = (size_t)fr->width * (size_t)fr->height * 3U;
+  fr->data = malloc(size);
+  if ((fr->data == NULL) || (fread(fr->data, 1, size, f) != size)) {
+    free(fr->data);
+    fclose(f);
+    return -1;
+  }
+  fclose(f);
+  frame_num++;
+  return 0;
+}
+
+/* Load ML_In SDS recording, one RGB888 ML image per record (timestamp, size, data) */
+static int load_sds(const char *name) {
+  FILE    *f = fopen(name, "rb");
+  uint32_t hdr[2];
+  int      n = 0;
+
+  if (f == NULL) {
+    return -1;
+  }
+  while ((frame_num < MAX_FRAMES) && (fread(hdr, sizeof(uint32_t), 2, f) == 2)) {
+    if (hdr[1] != ML_IMAGE_SIZE) {
+      // Not an ML_In record: skip it
+      if (fseek(f, (long)hdr[1], SEEK_CUR) != 0) {
+        break;
+      }
+      continue;
+    }
+    frames[frame_num].data   = malloc(ML_IMAGE_SIZE);
+    frames[frame_num].width  = ML_IMAGE_WIDTH;
+    frames[frame_num].height = ML_IMAGE_HEIGHT;
+    if ((frames[frame_num].data == NULL) ||
+        (fread(frames[frame_num].data, 1, ML_IMAGE_SIZE, f) != ML_IMAGE_SIZE)) {
+      free(frames[frame_num].data);
+      break;
+    }
+    frame_num++;
+    n++;
+  }
+  fclose(f);
+  return (n > 0) ? 0 : -1;
+}
+
+/* Synthetic gradient frame, used when no input is given */
+static void load_synthetic(void) {
+  frame_t *fr = &frames[frame_num++];
+
+  fr->width  = ML_IMAGE_WIDTH;
+  fr->height = ML_IMAGE_HEIGHT;
+  fr->data   = malloc(ML_IMAGE_SIZE);
+  for (int y = 0; y < fr->height; ++y) {
+    for (int x = 0; x < fr->width; ++x) {
+      uint8_t *p = &fr->data[(y * fr->width + x) * 3];
+      p[0] = (uint8_t)x;
+      p[1] = (uint8_t)y;
+      p[2] = (uint8_t)(x ^ y);
+    }
+  }
+}
+
+/* Scale frame up to the camera frame and store it as RGB565 and as RAW8 Bayer mosaic */
+static int make_camera_frames(frame_t *frame) {
+  static uint8_t cam_rgb888[CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT * 3];
+  /* Channel sampled at [row parity][column parity] per Bayer pattern (0=R, 1=G, 2=B) */
+  static const uint8_t bayer_ch[4][2][2] = {
+    { { 0, 1 }, { 1, 2 } },     /* RGGB */
+    { { 2, 1 }, { 1, 0 } },     /* BGGR */
+    { { 1, 0 }, { 2, 1 } },     /* GRBG */
+    { { 1, 2 }, { 0, 1 } }      /* GBRG */
+  };
+
+  frame->rgb565 = malloc(CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT * 2);
+  frame->raw8   = malloc(CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT);
+  if ((frame->rgb565 == NULL) || (frame->raw8 == NULL)) {
+    return -1;
+  }
+
+  image_resize(frame->data, frame->width, frame->height,
+               cam_rgb888, CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT,
+               IMAGE_FORMAT_RGB888, IMAGE_FORMAT_RGB888);
+
+  for (int y = 0; y < CAMERA_FRAME_HEIGHT; ++y) {
+    for (int x = 0; x < CAMERA_FRAME_WIDTH; ++x) {
+      const uint8_t *p  = &cam_rgb888[(y * CAMERA_FRAME_WIDTH + x) * 3];
+      uint16_t       px = (uint16_t)(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+
+      frame->rgb565[(y * CAMERA_FRAME_WIDTH + x) * 2 + 0] = (uint8_t)(px & 0xFF);
+      frame->rgb565[(y * CAMERA_FRAME_WIDTH + x) * 2 + 1] = (uint8_t)(px >> 8);
+      frame->raw8  [ y * CAMERA_FRAME_WIDTH + x]          = p[bayer_ch[CAMERA_FRAME_BAYER][y & 1][x & 1]];
+    }
+  }
+  return 0;
+}
+
+/* Stages */
+
+static void stage_resize_nearest(const frame_t *frame) {
+  image_resize_plan_run(&plan_nearest, frame->rgb565, ml_image);
+}
+
+static void stage_resize_bilinear(const frame_t *frame) {
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+}
+
+static void stage_resize_area(const frame_t *frame) {
+  image_resize_plan_run(&plan_area, frame->rgb565, ml_image);
+}
+
+static void stage_crop_debayer(const frame_t *frame) {
+  crop_and_debayer(frame->raw8, CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT, ML_CROP_X, ML_CROP_Y,
+                   ml_image, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, CAMERA_FRAME_BAYER);
+}
+
+static void stage_blit(const frame_t *frame) {
+  // Blit the ML image of this frame, produced outside of the timed region
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  time_start = time_ns();
+  image_copy_to_framebuffer(ml_image, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT,
+                            lcd_frame, DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT,
+                            (DISPLAY_FRAME_WIDTH  - ML_IMAGE_WIDTH)  / 2,
+                            (DISPLAY_FRAME_HEIGHT - ML_IMAGE_HEIGHT) / 2,
+                            IMAGE_FORMAT_RGB888,
+                            DISPLAY_FLIP_HORIZONTAL, DISPLAY_FLIP_VERTICAL, DISPLAY_SWAP_RB);
+}
+
+static void stage_motion_gate(const frame_t *frame) {
+  // Check the ML image of this frame, produced outside of the timed region
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  time_start = time_ns();
+  motion_gate_check(ml_image, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT);
+}
+
+static void stage_overlay_update(const frame_t *frame) {
+  static const char *const names[4] = { "PAPER", "ROCK", "SCISSORS", "UNKNOWN" };
+  static uint32_t          n;
+  float                    probs[4];
+
+  // Vary the result so that the overlay is redrawn on every run
+  (void)frame;
+  n++;
+  probs[0] = (float)(n % 100U) / 100.0f;
+  probs[1] = 1.0f - probs[0];
+  probs[2] = 0.0f;
+  probs[3] = 0.0f;
+  display_overlay_set_result((n & 1U) ? "ROCK-97" : "PAPER-42", probs, names, 4);
+}
+
+static void stage_overlay_stats(const frame_t *frame) {
+  static uint32_t n;
+  char            text[DISPLAY_OVERLAY_STATS_SIZE];
+
+  (void)frame;
+  n++;
+  snprintf(text, sizeof(text), "FPS %u.%u  LATENCY %u.%u MS\nSHOWN %u  SKIPPED %u",
+           (unsigned)(n % 30U), (unsigned)(n % 10U), (unsigned)(n % 50U), (unsigned)(n % 7U),
+           (unsigned)n, (unsigned)(n / 8U));
+  display_overlay_set_stats(text);
+}
+
+static void stage_overlay_draw(const frame_t *frame) {
+  // Change the statistics outside of the timed region, so that its area is copied on every run
+  stage_overlay_stats(frame);
+  time_start = time_ns();
+  display_overlay_draw(lcd_frame, DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT,
+                       (DISPLAY_FRAME_WIDTH - DISPLAY_OVERLAY_WIDTH) / 2, 0,
+                       DISPLAY_FLIP_HORIZONTAL, DISPLAY_FLIP_VERTICAL, DISPLAY_SWAP_RB);
+}
+
+#ifdef HOST_BENCH_RUNNER
+static void stage_preprocess(const frame_t *frame) {
+  // Pre-process the ML image of this frame, produced outside of the timed region
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  time_start = time_ns();
+  host_pipeline_preprocess(ml_image);
+}
+
+static void stage_inference(const frame_t *frame) {
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  host_pipeline_preprocess(ml_image);
+  time_start = time_ns();
+  if (host_pipeline_inference() != 0) {
+    printf("Inference failed\n");
+    exit(1);
+  }
+}
+
+static void stage_postprocess(const frame_t *frame) {
+  // Decode the result of this frame, inferred outside of the timed region
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  host_pipeline_preprocess(ml_image);
+  if (host_pipeline_inference() != 0) {
+    printf("Inference failed\n");
+    exit(1);
+  }
+  time_start = time_ns();
+  host_pipeline_postprocess(algo_out, sizeof(algo_out));
+}
+
+static void stage_algorithm(const frame_t *frame) {
+  image_resize_plan_run(&plan_bilinear, frame->rgb565, ml_image);
+  time_start = time_ns();
+  if (ExecuteAlgorithm(ml_image, sizeof(ml_image), algo_out, sizeof(algo_out)) != 0) {
+    printf("ExecuteAlgorithm failed\n");
+    exit(1);
+  }
+}
+#endif
+
+static const stage_t stages[] = {
+  { "capture transform (RGB565, nearest)",  stage_resize_nearest  },
+  { "capture transform (RGB565, bilinear)", stage_resize_bilinear },
+  { "capture transform (RGB565, area)",     stage_resize_area     },
+  { "capture transform (RAW8, debayer)",    stage_crop_debayer    },
+  { "display blit",                         stage_blit            },
+  { "motion gate",                          stage_motion_gate     },
+  { "overlay update",                       stage_overlay_update  },
+  { "overlay stats",                        stage_overlay_stats   },
+  { "overlay composite (statistics)",       stage_overlay_draw    },
+#ifdef HOST_BENCH_RUNNER
+  { "preprocess",                           stage_preprocess      },
+  { "inference (stub NPU)",                 stage_inference       },
+  { "postprocess",                          stage_postprocess     },
+  { "algorithm frame (ExecuteAlgorithm)",   stage_algorithm       },
+#endif
+};
+
+/* Time one stage over all frames and print its latency distribution */
+static void run_stage(const stage_t *stage, int iterations) {
+  int n = 0;
+
+  for (int i = 0; i < iterations; ++i) {
+    time_start = time_ns();
+    stage->run(&frames[i % frame_num]);
+    samples[n++] = time_ns() - time_start;
+  }
+
+  qsort(samples, (size_t)n, sizeof(samples[0]), compare_u64);
+  printf("%-38s %6d %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+         stage->name, n,
+         (double)samples[0]                         / 1000.0,
+         (double)samples[(n * 50) / 100]            / 1000.0,
+         (double)samples[(n * 95) / 100]            / 1000.0,
+         (double)samples[(n * 99) / 100]            / 1000.0,
+         (double)samples[n - 1]                     / 1000.0);
+}
+
+int main(int argc, char *argv[]) {
+  int iterations = 200;
+
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    size_t      len = strlen(arg);
+
+    if ((strcmp(arg, "-n") == 0) && ((i + 1) < argc)) {
+      iterations = atoi(argv[++i]);
+    } else if ((len > 4) && (strcmp(&arg[len - 4], ".sds") == 0)) {
+      if (load_sds(arg) != 0) {
+        printf("Failed to load SDS file %s\n", arg);
+        return 1;
+      }
+    } else if ((len > 4) && (strcmp(&arg[len - 4], ".ppm") == 0)) {
+      if (load_ppm(arg) != 0) {
+        printf("Failed to load PPM file %s\n", arg);
+        return 1;
+      }
+    } else {
+      printf("Usage: %s [-n iterations] [ML_In.<n>.sds | image.ppm]...\n", argv[0]);
+      return 1;
+    }
+  }
+  if ((iterations < 1) || (iterations > MAX_ITERATIONS)) {
+    printf("Iterations must be in range 1..%d\n", MAX_ITERATIONS);
+    return 1;
+  }
+  if (frame_num == 0) {
+    load_synthetic();
+  }
+  for (int i = 0; i < frame_num; ++i) {
+    if (make_camera_frames(&frames[i]) != 0) {
+      printf("Out of memory\n");
+      return 1;
+    }
+  }
+
+  image_resize_plan_init(&plan_nearest,  CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT, IMAGE_FORMAT_RGB565,
+                         ML_CROP_X, ML_CROP_Y, ML_CROP_WIDTH, ML_CROP_HEIGHT,
+                         ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, IMAGE_RESIZE_NEAREST);
+  image_resize_plan_init(&plan_bilinear, CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT, IMAGE_FORMAT_RGB565,
+                         ML_CROP_X, ML_CROP_Y, ML_CROP_WIDTH, ML_CROP_HEIGHT,
+                         ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, IMAGE_RESIZE_BILINEAR);
+  image_resize_plan_init(&plan_area,     CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT, IMAGE_FORMAT_RGB565,
+                         ML_CROP_X, ML_CROP_Y, ML_CROP_WIDTH, ML_CROP_HEIGHT,
+                         ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT, IMAGE_RESIZE_AREA);
+
+#ifdef HOST_BENCH_RUNNER
+  // Loads the stub model and initializes the overlay
+  if (host_pipeline_init() != 0) {
+    printf("Algorithm initialization failed\n");
+    return 1;
+  }
+  printf("\n");
+#else
+  display_overlay_init();
+#endif
+
+  printf("Camera %dx%d, ML image %dx%d, display %dx%d, %d frame(s)\n\n",
+         CAMERA_FRAME_WIDTH, CAMERA_FRAME_HEIGHT, ML_IMAGE_WIDTH, ML_IMAGE_HEIGHT,
+         DISPLAY_FRAME_WIDTH, DISPLAY_FRAME_HEIGHT, frame_num);
+  printf("%-38s %6s %9s %9s %9s %9s %9s\n", "Stage [us]", "runs", "min", "p50", "p95", "p99", "max");
+  for (size_t s = 0; s < (sizeof(stages) / sizeof(stages[0])); ++s) {
+    run_stage(&stages[s], iterations);
+  }
+
+  return 0;
+}
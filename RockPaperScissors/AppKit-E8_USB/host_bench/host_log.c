@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host replacement of log_ring.c for the host_bench runner build.
+
+  On the target the log records are formatted by the low-priority log
+  thread, outside of the pipeline stages. The host build only counts them,
+  so the timed stages are not dominated by console output.
+*/
+
+#include <stdint.h>
+
+#include "log_ring.h"
+
+/* Number of log records written */
+uint32_t host_log_records;
+
+void log_ring_write(uint32_t id, const uint32_t *args, uint32_t argc) {
+  (void)id;
+  (void)args;
+  (void)argc;
+  host_log_records++;
+}
+
+uint32_t log_ring_dropped(void) {
+  return 0U;
+}
+
+int32_t log_ring_init(void) {
+  return 0;
+}
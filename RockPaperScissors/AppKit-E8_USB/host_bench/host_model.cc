@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Stub model of the host_bench runner build.
+
+  The model PTE of the application (ai_layer/model/model_pte.h) is generated
+  by the model conversion and is not part of the repository. This builds a
+  program with the same structure as the converted SqueezeNet: a float
+  [1, 3, 224, 224] input quantized by quantize_per_tensor, one Ethos-U
+  delegate producing int8 logits and a dequantize_per_tensor to the float
+  [1, 4] output. All tensors are memory planned. The delegate is a
+  vela_bin_stream whose command stream is executed by the stub Ethos-U
+  driver (host_npu.c).
+*/
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <executorch/schema/program_generated.h>
+
+#include "host_npu.h"
+#include "model_pte.h"
+
+namespace fb = executorch_flatbuffer;
+
+/* Input, logits and quantization parameters of the stub model */
+#define MODEL_INPUT_NUMEL    (1 * 3 * 224 * 224)
+#define MODEL_NUM_CLASSES    4
+#define MODEL_INPUT_SCALE    (1.0 / 48.0)
+#define MODEL_OUTPUT_SCALE   (1.0 / 16.0)
+
+alignas(16) unsigned char model_pte[HOST_MODEL_PTE_SIZE];
+
+namespace {
+
+/* Round up to a multiple of 16 */
+constexpr uint32_t align16(uint32_t n) {
+    return (n + 15U) & ~15U;
+}
+
+/**
+ * \brief Append one block (name, size, data padded to 16 bytes) to a vela_bin_stream
+ * \param[in,out] stream Stream data
+ * \param[in]     name   Block name, at most 15 characters
+ * \param[in]     data   Block data
+ * \param[in]     size   Block data size in bytes
+ */
+void vela_block(std::vector<uint8_t>& stream, const char* name,
+                const void* data, uint32_t size) {
+    uint8_t header[32] = {};
+
+    strncpy(reinterpret_cast<char*>(header), name, 15);
+    memcpy(&header[16], &size, sizeof(size));
+    stream.insert(stream.end(), header, header + sizeof(header));
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    stream.insert(stream.end(), bytes, bytes + size);
+    stream.resize(stream.size() + (align16(size) - size), 0U);
+}
+
+/**
+ * \brief vela_bin_stream of the stub delegate: int8 input at the start of
+ *        the scratch area, followed by the int8 logits
+ * \return Stream data
+ */
+std::vector<uint8_t> vela_bin_stream(void) {
+    struct {
+        int count;
+        int shape[6];
+        int elem_size;
+        int offset;
+        int region;
+    } input = {1, {1, 224, 224, 3, 1, 1}, 1, 0, HOST_NPU_SCRATCH_REGION},
+      output = {1, {1, 1, 1, 1, 1, MODEL_NUM_CLASSES}, 1,
+                static_cast<int>(align16(MODEL_INPUT_NUMEL)),
+                HOST_NPU_SCRATCH_REGION};
+    const uint32_t scratch_size =
+        align16(MODEL_INPUT_NUMEL) + align16(MODEL_NUM_CLASSES);
+    const host_npu_cmd_t cmd = {{'C', 'O', 'P', '1'},
+                                0U,
+                                MODEL_INPUT_NUMEL,
+                                align16(MODEL_INPUT_NUMEL),
+                                MODEL_NUM_CLASSES};
+    const uint8_t weights[16] = {};
+    std::vector<uint8_t> stream;
+
+    vela_block(stream, "vela_bin_stream", nullptr, 0U);
+    vela_block(stream, "cmd_data", &cmd, sizeof(cmd));
+    vela_block(stream, "weight_data", weights, sizeof(weights));
+    vela_block(stream, "scratch_size", &scratch_size, sizeof(scratch_size));
+    vela_block(stream, "inputs", &input, sizeof(input));
+    vela_block(stream, "outputs", &output, sizeof(output));
+    vela_block(stream, "vela_end_stream", nullptr, 0U);
+    return stream;
+}
+
+/**
+ * \brief Memory planned tensor value
+ * \param[in] fbb    Flatbuffer builder
+ * \param[in] type   Scalar type
+ * \param[in] sizes  Tensor sizes
+ * \param[in] offset Offset in planned buffer 1
+ * \return Value offset
+ */
+flatbuffers::Offset<fb::EValue> tensor_value(flatbuffers::FlatBufferBuilder& fbb,
+                                             fb::ScalarType type,
+                                             const std::vector<int32_t>& sizes,
+                                             uint32_t offset) {
+    std::vector<uint8_t> dim_order;
+
+    for (size_t i = 0; i < sizes.size(); i++) {
+        dim_order.push_back(static_cast<uint8_t>(i));
+    }
+    auto tensor = fb::CreateTensorDirect(
+        fbb, type, 0, &sizes, &dim_order, false, 0U,
+        fb::CreateAllocationDetails(fbb, 1U, offset, 0U));
+    return fb::CreateEValue(fbb, fb::KernelTypes::Tensor, tensor.Union());
+}
+
+/* Int value */
+flatbuffers::Offset<fb::EValue> int_value(flatbuffers::FlatBufferBuilder& fbb,
+                                          int64_t value) {
+    return fb::CreateEValue(fbb, fb::KernelTypes::Int,
+                            fb::CreateInt(fbb, value).Union());
+}
+
+/* Double value */
+flatbuffers::Offset<fb::EValue> double_value(flatbuffers::FlatBufferBuilder& fbb,
+                                             double value) {
+    return fb::CreateEValue(fbb, fb::KernelTypes::Double,
+                            fb::CreateDouble(fbb, value).Union());
+}
+
+/* Call of operator op_index with the values args */
+flatbuffers::Offset<fb::Instruction> kernel_call(
+    flatbuffers::FlatBufferBuilder& fbb, int32_t op_index,
+    const std::vector<int32_t>& args) {
+    return fb::CreateInstruction(
+        fbb, fb::InstructionArguments::KernelCall,
+        fb::CreateKernelCallDirect(fbb, op_index, &args).Union());
+}
+
+} /* namespace */
+
+int host_model_build(void) {
+    flatbuffers::FlatBufferBuilder fbb;
+
+    /* Planned buffer 1: float input, int8 input, int8 logits, float logits */
+    const uint32_t in_q_offset = align16(sizeof(float) * MODEL_INPUT_NUMEL);
+    const uint32_t logits_q_offset = in_q_offset + align16(MODEL_INPUT_NUMEL);
+    const uint32_t logits_offset = logits_q_offset + align16(MODEL_NUM_CLASSES);
+    const uint32_t planned_size =
+        logits_offset + align16(sizeof(float) * MODEL_NUM_CLASSES);
+
+    const std::vector<flatbuffers::Offset<fb::EValue>> values = {
+        /* 0 */ tensor_value(fbb, fb::ScalarType::FLOAT, {1, 3, 224, 224}, 0U),
+        /* 1 */ double_value(fbb, MODEL_INPUT_SCALE),
+        /* 2 */ int_value(fbb, 0),
+        /* 3 */ int_value(fbb, -128),
+        /* 4 */ int_value(fbb, 127),
+        /* 5 */ int_value(fbb, static_cast<int64_t>(fb::ScalarType::CHAR)),
+        /* 6 */ tensor_value(fbb, fb::ScalarType::CHAR, {1, 3, 224, 224}, in_q_offset),
+        /* 7 */ tensor_value(fbb, fb::ScalarType::CHAR, {1, MODEL_NUM_CLASSES}, logits_q_offset),
+        /* 8 */ tensor_value(fbb, fb::ScalarType::FLOAT, {1, MODEL_NUM_CLASSES}, logits_offset),
+        /* 9 */ double_value(fbb, MODEL_OUTPUT_SCALE),
+        /* 10 */ fb::CreateEValue(fbb, fb::KernelTypes::Null, fb::CreateNull(fbb).Union()),
+    };
+    const std::vector<flatbuffers::Offset<fb::Operator>> operators = {
+        fb::CreateOperatorDirect(fbb, "quantized_decomposed::quantize_per_tensor", "out"),
+        fb::CreateOperatorDirect(fbb, "quantized_decomposed::dequantize_per_tensor", "out"),
+    };
+    const std::vector<int32_t> delegate_args = {6, 7};
+    const std::vector<flatbuffers::Offset<fb::Instruction>> instructions = {
+        kernel_call(fbb, 0, {0, 1, 2, 3, 4, 5, 6, 6}),
+        fb::CreateInstruction(
+            fbb, fb::InstructionArguments::DelegateCall,
+            fb::CreateDelegateCallDirect(fbb, 0, &delegate_args).Union()),
+        kernel_call(fbb, 1, {7, 9, 2, 3, 4, 5, 10, 8, 8}),
+    };
+    const std::vector<int32_t> inputs = {0};
+    const std::vector<int32_t> outputs = {8};
+    const std::vector<flatbuffers::Offset<fb::Chain>> chains = {
+        fb::CreateChainDirect(fbb, &inputs, &outputs, &instructions),
+    };
+    const std::vector<flatbuffers::Offset<fb::CompileSpec>> compile_specs;
+    const std::vector<flatbuffers::Offset<fb::BackendDelegate>> delegates = {
+        fb::CreateBackendDelegateDirect(
+            fbb, "EthosUBackend",
+            fb::CreateBackendDelegateDataReference(fbb, fb::DataLocation::INLINE, 0U),
+            &compile_specs),
+    };
+    const std::vector<int64_t> buffer_sizes = {0, planned_size};
+    const std::vector<flatbuffers::Offset<fb::ExecutionPlan>> plans = {
+        fb::CreateExecutionPlanDirect(fbb, "forward", 0, &values, &inputs,
+                                      &outputs, &chains, &operators,
+                                      &delegates, &buffer_sizes),
+    };
+    const std::vector<uint8_t> stream = vela_bin_stream();
+    const std::vector<flatbuffers::Offset<fb::BackendDelegateInlineData>> delegate_data = {
+        fb::CreateBackendDelegateInlineDataDirect(fbb, &stream),
+    };
+    /* No constants: the constant segment only holds the placeholder offset */
+    const std::vector<uint64_t> constant_offsets = {0U};
+    auto constant_segment =
+        fb::CreateSubsegmentOffsetsDirect(fbb, 0U, &constant_offsets);
+
+    fb::FinishProgramBuffer(
+        fbb, fb::CreateProgramDirect(fbb, 0U, &plans, nullptr, &delegate_data,
+                                     nullptr, constant_segment));
+
+    if (fbb.GetSize() > sizeof(model_pte)) {
+        return -1;
+    }
+    memset(model_pte, 0, sizeof(model_pte));
+    memcpy(model_pte, fbb.GetBufferPointer(), fbb.GetSize());
+    return 0;
+}
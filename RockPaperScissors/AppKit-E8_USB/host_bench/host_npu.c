@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host stub of the Ethos-U driver for the host_bench runner build.
+
+  Implements the driver functions used by the Ethos-U backend of ExecuTorch.
+  A job runs the command stream of the stub model (host_npu.h) on the CPU
+  when it is waited for, so that the model outputs depend on the input
+  image and post-processing sees varying results.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ethosu_driver.h"
+#include "host_npu.h"
+
+static struct ethosu_driver npu_driver;
+
+/* Run the stub model command stream of the current job */
+static int npu_run_job (struct ethosu_driver *drv) {
+  const struct ethosu_job *job = &drv->job;
+  host_npu_cmd_t           cmd;
+  int8_t                  *scratch;
+  uint32_t                 slice;
+
+  if ((job->custom_data_size < (int)sizeof(cmd)) || (job->num_base_addr <= HOST_NPU_SCRATCH_REGION)) {
+    return -1;
+  }
+  memcpy(&cmd, job->custom_data_ptr, sizeof(cmd));
+  if ((memcmp(cmd.magic, "COP1", 4) != 0) || (cmd.output_count == 0U) ||
+      ((cmd.input_offset  + cmd.input_size)   > job->base_addr_size[HOST_NPU_SCRATCH_REGION]) ||
+      ((cmd.output_offset + cmd.output_count) > job->base_addr_size[HOST_NPU_SCRATCH_REGION])) {
+    return -1;
+  }
+
+  scratch = (int8_t *)(uintptr_t)job->base_addr[HOST_NPU_SCRATCH_REGION];
+  slice   = cmd.input_size / cmd.output_count;
+  for (uint32_t k = 0U; k < cmd.output_count; k++) {
+    const int8_t *in  = &scratch[cmd.input_offset + (k * slice)];
+    int32_t       sum = 0;
+
+    for (uint32_t i = 0U; i < slice; i++) {
+      sum += in[i];
+    }
+    scratch[cmd.output_offset + k] = (int8_t)((slice != 0U) ? (sum / (int32_t)slice) : 0);
+  }
+  return 0;
+}
+
+int ethosu_invoke_async (struct ethosu_driver *drv, const void *custom_data_ptr, const int custom_data_size,
+                         uint64_t *const base_addr, const size_t *base_addr_size, const int num_base_addr,
+                         void *user_arg) {
+  if (drv->job.state != ETHOSU_JOB_IDLE) {
+    return -1;
+  }
+  drv->job.custom_data_ptr  = custom_data_ptr;
+  drv->job.custom_data_size = custom_data_size;
+  drv->job.base_addr        = base_addr;
+  drv->job.base_addr_size   = base_addr_size;
+  drv->job.num_base_addr    = num_base_addr;
+  drv->job.user_arg         = user_arg;
+  drv->job.result           = ETHOSU_JOB_RESULT_OK;
+  drv->job.state            = ETHOSU_JOB_RUNNING;
+  return 0;
+}
+
+int ethosu_wait (struct ethosu_driver *drv, bool block) {
+  (void)block;
+  if (drv->job.state != ETHOSU_JOB_RUNNING) {
+    return -2;
+  }
+  drv->job.result = (npu_run_job(drv) == 0) ? ETHOSU_JOB_RESULT_OK : ETHOSU_JOB_RESULT_ERROR;
+  drv->job.state  = ETHOSU_JOB_IDLE;
+  return (drv->job.result == ETHOSU_JOB_RESULT_OK) ? 0 : -1;
+}
+
+int ethosu_invoke_v3 (struct ethosu_driver *drv, const void *custom_data_ptr, const int custom_data_size,
+                      uint64_t *const base_addr, const size_t *base_addr_size, const int num_base_addr,
+                      void *user_arg) {
+  int result = ethosu_invoke_async(drv, custom_data_ptr, custom_data_size, base_addr, base_addr_size,
+                                   num_base_addr, user_arg);
+  if (result == 0) {
+    result = ethosu_wait(drv, true);
+  }
+  return result;
+}
+
+struct ethosu_driver *ethosu_reserve_driver (void) {
+  if (npu_driver.reserved) {
+    return NULL;
+  }
+  npu_driver.reserved = true;
+  return &npu_driver;
+}
+
+void ethosu_release_driver (struct ethosu_driver *drv) {
+  if (drv != NULL) {
+    drv->reserved = false;
+  }
+}
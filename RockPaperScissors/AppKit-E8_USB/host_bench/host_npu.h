@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Command stream of the host_bench stub model, shared by host_model.cc and the stub Ethos-U driver */
+
+#ifndef HOST_NPU_H
+#define HOST_NPU_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Base address index of the scratch region (inputs and outputs) */
+#define HOST_NPU_SCRATCH_REGION  1
+
+/*
+  The command stream of the stub model: after the "COP1" magic the Ethos-U
+  backend checks for, the location of the int8 input and of the int8 logits
+  in the scratch region. The stub driver sets each logit to the mean of one
+  equal slice of the input.
+*/
+typedef struct {
+  char     magic[4];            /* "COP1"                          */
+  uint32_t input_offset;        /* Input offset in scratch         */
+  uint32_t input_size;          /* Input size in bytes             */
+  uint32_t output_offset;       /* Logits offset in scratch        */
+  uint32_t output_count;        /* Number of logits                */
+} host_npu_cmd_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_NPU_H */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Pipeline stages of the AlgorithmTest application for host_bench.
+
+  C interface to the runner (arm_executor_runner.cc) of the host_bench
+  runner build, so that pre-processing, inference and post-processing can
+  be timed one by one. ExecuteAlgorithm() (sds_algorithm_user.cpp) times
+  the complete frame.
+*/
+
+#include <cstdint>
+
+#include "arm_executor_runner.h"
+#include "host_pipeline.h"
+#include "model_pte.h"
+#include "sds_algorithm.h"
+
+int host_pipeline_init(void) {
+    if (host_model_build() != 0) {
+        return -1;
+    }
+    return InitAlgorithm();
+}
+
+void host_pipeline_preprocess(const uint8_t *image) {
+    preprocess(image);
+}
+
+int host_pipeline_inference(void) {
+    return run_inference(*runner_context_instance()) ? 0 : -1;
+}
+
+void host_pipeline_postprocess(uint8_t *out_buf, uint32_t out_num) {
+    postprocess(*runner_context_instance(), out_buf, out_num);
+}
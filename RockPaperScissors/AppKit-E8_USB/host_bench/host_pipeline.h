@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Pipeline stages of the AlgorithmTest application for host_bench (host_pipeline.cc) */
+
+#ifndef HOST_PIPELINE_H
+#define HOST_PIPELINE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Build the stub model and initialize the algorithm (InitAlgorithm)
+ * \return 0 on success, -1 on error
+ */
+int host_pipeline_init(void);
+
+/**
+ * \brief Pre-process an ML image into the model input (preprocess)
+ * \param[in] image ML image, RGB888
+ */
+void host_pipeline_preprocess(const uint8_t *image);
+
+/**
+ * \brief Run the model on the pre-processed input (run_inference)
+ * \return 0 on success, -1 on error
+ */
+int host_pipeline_inference(void);
+
+/**
+ * \brief Decode the model output and update the overlay result (postprocess)
+ * \param[out] out_buf Algorithm output data
+ * \param[in]  out_num Size of out_buf in bytes
+ */
+void host_pipeline_postprocess(uint8_t *out_buf, uint32_t out_num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_PIPELINE_H */
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host stub of the CMSIS vStream VideoOut driver for the host_bench runner build.
+
+  The display takes each released frame at once, so GetBlock() always
+  returns the next frame buffer of the ring set with SetBuf().
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cmsis_vstream.h"
+
+static uint8_t        *video_buf;
+static uint32_t        video_buf_size;
+static uint32_t        video_block_size;
+static uint32_t        video_block;
+static uint8_t         video_block_held;
+static vStreamStatus_t video_status;
+
+static int32_t VideoOut_Initialize (vStreamEvent_t event_cb) {
+  (void)event_cb;
+  video_buf        = NULL;
+  video_block      = 0U;
+  video_block_held = 0U;
+  return VSTREAM_OK;
+}
+
+static int32_t VideoOut_Uninitialize (void) {
+  video_buf = NULL;
+  return VSTREAM_OK;
+}
+
+static int32_t VideoOut_SetBuf (void *buf, uint32_t buf_size, uint32_t block_size) {
+  if ((buf == NULL) || (block_size == 0U) || (buf_size < block_size)) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+  video_buf        = (uint8_t *)buf;
+  video_buf_size   = buf_size;
+  video_block_size = block_size;
+  video_block      = 0U;
+  return VSTREAM_OK;
+}
+
+static int32_t VideoOut_Start (uint32_t mode) {
+  /* A single frame is shown at once, only a continuous stream stays active */
+  video_status.active = (mode == VSTREAM_MODE_SINGLE) ? 0U : 1U;
+  return VSTREAM_OK;
+}
+
+static int32_t VideoOut_Stop (void) {
+  video_status.active = 0U;
+  return VSTREAM_OK;
+}
+
+static void *VideoOut_GetBlock (void) {
+  if ((video_buf == NULL) || (video_block_held != 0U)) {
+    return NULL;
+  }
+  video_block_held = 1U;
+  return &video_buf[video_block * video_block_size];
+}
+
+static int32_t VideoOut_ReleaseBlock (void) {
+  if (video_block_held == 0U) {
+    return VSTREAM_ERROR;
+  }
+  video_block_held = 0U;
+  video_block++;
+  if (((video_block + 1U) * video_block_size) > video_buf_size) {
+    video_block = 0U;
+  }
+  return VSTREAM_OK;
+}
+
+static vStreamStatus_t VideoOut_GetStatus (void) {
+  return video_status;
+}
+
+vStreamDriver_t Driver_vStreamVideoOut = {
+  VideoOut_Initialize,
+  VideoOut_Uninitialize,
+  VideoOut_SetBuf,
+  VideoOut_Start,
+  VideoOut_Stop,
+  VideoOut_GetBlock,
+  VideoOut_ReleaseBlock,
+  VideoOut_GetStatus
+};
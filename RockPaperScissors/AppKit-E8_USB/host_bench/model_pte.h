@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Host replacement of ai_layer/model/model_pte.h: the stub model built by host_model.cc */
+
+#ifndef HOST_MODEL_PTE_H
+#define HOST_MODEL_PTE_H
+
+/* Size of the buffer holding the stub model, multiple of 16 */
+#define HOST_MODEL_PTE_SIZE  4096U
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Stub model PTE, filled by host_model_build() */
+extern unsigned char model_pte[HOST_MODEL_PTE_SIZE];
+
+/**
+ * \brief Build the stub model into model_pte, call before InitAlgorithm()
+ * \return 0 on success, -1 if the model does not fit
+ */
+int host_model_build(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_MODEL_PTE_H */
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Host replacement of the board profiler.h for the host_bench runner build */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CPU_FREQ_HZ   (400000000UL)
+
+/** \brief Enable time profiling logs (host_bench measures the stages itself) */
+#define ENABLE_TIME_PROFILING (0)
+
+/**
+ * \brief Host time in cycles of a CPU_FREQ_HZ clock
+ * \return cycle counter value
+ */
+static inline uint32_t profiler_cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * CPU_FREQ_HZ) +
+                      (((uint64_t)ts.tv_nsec * (CPU_FREQ_HZ / 1000000UL)) / 1000U));
+}
+
+/**
+ * \brief Start profiling section
+ * \return cycle counter value at start
+ */
+static inline uint32_t profiler_start(void)
+{
+    return profiler_cycles();
+}
+
+/**
+ * \brief Stop profiling section
+ * \param start_cycle cycle count returned by profiler_start()
+ * \return elapsed cycles
+ */
+static inline uint32_t profiler_stop(uint32_t start_cycle)
+{
+    return (profiler_cycles() - start_cycle);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILER_H */
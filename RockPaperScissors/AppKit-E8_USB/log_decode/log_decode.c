@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  Host decoder of the binary log records of the AlgorithmTest application.
+
+  With LOG_RING_BINARY the application writes the log records unchanged to
+  STDOUT, mixed with the text of the remaining printf output. The decoder
+  copies text through and formats each record with the format table of
+  ../algorithm/log_format.c, so the format ids always match the target.
+
+  See README.md for build and usage.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log_format.h"
+
+/* Input buffer size, holds at least one complete record */
+#define BUF_SIZE    65536U
+
+static uint8_t buf[BUF_SIZE];
+
+/* Little-endian 32-bit word */
+static uint32_t get_word(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*
+  Decode the record at data[0] (LOG_RECORD_MAGIC).
+  Returns the record size in bytes, 0 when more data is needed or -1 when it is not a record.
+*/
+static long decode_record(const uint8_t *data, size_t len, int timestamps, FILE *out) {
+  uint32_t args[255];
+  char     text[1024];
+  uint32_t header;
+  uint32_t argc;
+  size_t   size;
+
+  if (len < (LOG_RECORD_HEAD_WORDS * 4U)) {
+    return 0;
+  }
+  header = get_word(data);
+  argc   = LOG_RECORD_ARGC(header);
+  if (LOG_RECORD_ID(header) >= LOG_ID_COUNT) {
+    return -1;
+  }
+  size = (LOG_RECORD_HEAD_WORDS + argc) * 4U;
+  if (len < size) {
+    return 0;
+  }
+
+  for (uint32_t i = 0U; i < argc; i++) {
+    args[i] = get_word(&data[(LOG_RECORD_HEAD_WORDS + i) * 4U]);
+  }
+  log_format_record(text, sizeof(text), LOG_RECORD_ID(header), args, argc);
+
+  if (timestamps != 0) {
+    /* Cycle counter, wraps around */
+    fprintf(out, "[%12.3f ms] ", (double)get_word(&data[4]) / ((double)LOG_CPU_FREQ_HZ / 1000.0));
+  }
+  fputs(text, out);
+
+  return (long)size;
+}
+
+int main(int argc, char *argv[]) {
+  FILE  *in         = stdin;
+  int    timestamps = 0;
+  size_t len        = 0U;
+  int    eof        = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-t") == 0) {
+      timestamps = 1;
+    } else if ((argv[i][0] == '-') && (argv[i][1] != '\0')) {
+      fprintf(stderr, "Usage: %s [-t] [capture file]\n", argv[0]);
+      return 1;
+    } else if (strcmp(argv[i], "-") != 0) {
+      in = fopen(argv[i], "rb");
+      if (in == NULL) {
+        fprintf(stderr, "Cannot open %s\n", argv[i]);
+        return 1;
+      }
+    }
+  }
+
+  while ((eof == 0) || (len != 0U)) {
+    size_t pos = 0U;
+
+    if (eof == 0) {
+      size_t n = fread(&buf[len], 1U, BUF_SIZE - len, in);
+      if (n == 0U) {
+        eof = 1;
+      }
+      len += n;
+    }
+
+    while (pos < len) {
+      long size = -1;
+
+      if (buf[pos] == LOG_RECORD_MAGIC) {
+        size = decode_record(&buf[pos], len - pos, timestamps, stdout);
+        if ((size == 0) && (eof == 0)) {
+          /* Incomplete record, read more data */
+          break;
+        }
+      }
+      if (size > 0) {
+        pos += (size_t)size;
+      } else {
+        fputc(buf[pos++], stdout);
+      }
+    }
+
+    memmove(buf, &buf[pos], len - pos);
+    len -= pos;
+  }
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  return 0;
+}
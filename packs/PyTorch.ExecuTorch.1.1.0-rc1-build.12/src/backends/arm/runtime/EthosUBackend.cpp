@@ -34,7 +34,14 @@ class EventTraceScope {
     event_tracer_entry_scope = event_tracer->start_profiling(name);
   }
   ~EventTraceScope() {
-    event_tracer->end_profiling(event_tracer_entry_scope);
+    if (event_tracer != nullptr) {
+      event_tracer->end_profiling(event_tracer_entry_scope);
+    }
+  }
+  // Hands the open event over to the caller, which has to end it.
+  EventTracerEntry release() {
+    event_tracer = nullptr;
+    return event_tracer_entry_scope;
   }
 
  private:
@@ -83,25 +90,92 @@ namespace executorch {
 namespace backends {
 namespace arm {
 
+// How a delegate input or output is moved between the EValue tensor and the
+// Ethos-U scratch area. Selected on the first execute() and reused while the
+// tensor size stays the same.
+typedef enum {
+  kIOCopyUnplanned = 0,
+  kIOCopyMemcpy, // Sizes and element sizes match, plain memcpy
+  kIOCopyLayout, // Output needs copy_with_layout_adjustment()
+  kIOCopyInPlace, // Tensor data already at its scratch location
+} IOCopyKind;
+
+typedef struct {
+  size_t tensor_bytes; // Tensor size the copy routine was selected for
+  IOCopyKind copy;
+} IOPlan;
+
 typedef struct {
   FreeableBuffer* processed;
+  // Key sections of the vela_bin_stream, parsed once in init()
+  VelaHandles handles;
+  // Base address table for ethosu_invoke_v3(), only the scratch entry
+  // changes between executions
+  uint64_t bases[ETHOSU_NUM_BASE_ADDRS];
+  size_t bases_size[ETHOSU_NUM_BASE_ADDRS];
+  // One entry per delegate argument, inputs followed by outputs
+  IOPlan* io_plan;
+  int io_count;
 } ExecutionHandle;
 
+// Scratch shared by all delegates, set with EthosUBackend_set_scratch().
+// Only one delegate runs at a time, so one arena sized for the largest
+// scratch_data_size serves every loaded model. Its address is stable, so a
+// tensor the application binds at its scratch location (for example an
+// unplanned input through Method::set_input()) is used in place. When it is
+// not set, scratch is taken from the temp allocator on every execute().
+static char* shared_scratch = nullptr;
+static size_t shared_scratch_size = 0;
+// Largest scratch_data_size of the delegates initialized so far
+static size_t scratch_size_max = 0;
+
 extern "C" {
 void __attribute__((weak)) EthosUBackend_execute_begin() {}
 void __attribute__((weak)) EthosUBackend_execute_end() {}
+// Called whenever the binding of a delegate input or output is decided.
+// reason is nullptr when the tensor data is already at its scratch location,
+// otherwise it says why the I/O is copied.
+void __attribute__((weak))
+EthosUBackend_io_binding(int is_output, int index, const char* reason) {}
 __attribute__((weak)) unsigned char* ethosu_fast_scratch = nullptr;
 __attribute__((weak)) size_t ethosu_fast_scratch_size = 0;
 }
 
+// An Ethos-U job started by execute() with async requested, completed by
+// EthosUBackend_wait().
+typedef struct {
+  bool requested; // Next execute() should return once the NPU is started
+  ethosu_driver* driver; // Reserved driver of the running job, or nullptr
+  ExecutionHandle* handle;
+  Span<EValue*> args;
+  char* scratch;
+  executorch::runtime::EventTracer* event_tracer;
+#if defined(ET_EVENT_TRACER_ENABLED)
+  // "EthosUBackend::execute()" and its NPU event, ended by wait_async()
+  EventTracerEntry execute_entry;
+  EventTracerEntry npu_entry;
+#endif
+} AsyncJob;
+
+static AsyncJob async_job;
+
 class EthosUBackendExecuteCallbacks {
  public:
-  EthosUBackendExecuteCallbacks() {
+  EthosUBackendExecuteCallbacks() : active(true) {
     EthosUBackend_execute_begin();
   }
   ~EthosUBackendExecuteCallbacks() {
-    EthosUBackend_execute_end();
+    if (active) {
+      EthosUBackend_execute_end();
+    }
+  }
+  // EthosUBackend_execute_end() is called when the async job is collected.
+  void release() {
+    active = false;
   }
+
+ private:
+  bool active;
 };
 
 class EthosUBackend final : public ::executorch::runtime::BackendInterface {
@@ -138,6 +212,43 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
 
     handle->processed = processed;
 
+    // Read key sections from the vela_bin_stream once, the command stream,
+    // weights and I/O descriptors point into the processed buffer which is
+    // kept for the lifetime of the handle.
+    if (vela_bin_read(data, &handle->handles, size) == false) {
+      ET_LOG(Error, "vela_read: error, invalid binary layout");
+      return Error::InvalidProgram;
+    }
+
+    // Ethos-U low level driver expected order for Ethos U-55, we have
+    // constant weight data, then scratch (which contains input and output)
+    handle->bases[0] = static_cast<uint64_t>(
+        reinterpret_cast<uintptr_t>(handle->handles.weight_data));
+    handle->bases[1] = 0;
+    handle->bases[2] = static_cast<uint64_t>(
+        reinterpret_cast<uintptr_t>(ethosu_fast_scratch));
+    handle->bases_size[0] = handle->handles.weight_data_size;
+    handle->bases_size[1] = handle->handles.scratch_data_size;
+    handle->bases_size[2] = ethosu_fast_scratch_size;
+
+    handle->io_count =
+        handle->handles.inputs->count + handle->handles.outputs->count;
+    handle->io_plan =
+        allocator->allocateList<IOPlan>(static_cast<size_t>(handle->io_count));
+    if (handle->io_plan == nullptr) {
+      return Error::MemoryAllocationFailed;
+    }
+    for (int i = 0; i < handle->io_count; i++) {
+      handle->io_plan[i].tensor_bytes = 0;
+      handle->io_plan[i].copy = kIOCopyUnplanned;
+    }
+
+    // The shared scratch is sized by the application after all delegates
+    // are initialized, see EthosUBackend_scratch_size().
+    if (handle->handles.scratch_data_size > scratch_size_max) {
+      scratch_size_max = handle->handles.scratch_data_size;
+    }
+
     // Return the same buffer we were passed - this data will be
     // executed directly
     return handle;
@@ -152,6 +263,12 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
     EventTracerEntry event_tracer_local_scope;
 #endif
 
+    // The driver and scratch of an outstanding async job are still in use
+    if (async_job.driver != nullptr) {
+      ET_LOG(Error, "Ethos-U async job still pending, call EthosUBackend_wait()");
+      return Error::InvalidState;
+    }
+
     EXECUTORCH_PROF_SCOPE(event_tracer, "EthosUBackend::execute()");
 
     // CollectArm_CPU_Cycles is just used to save the numbers of CPU cycles
@@ -168,45 +285,43 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
 
     ExecutionHandle* execution_handle =
         static_cast<ExecutionHandle*>(input_handle);
-    VelaHandles handles;
+    const VelaHandles& handles = execution_handle->handles;
 
-    // Command stream - we know at this point it's aligned
-    EXECUTORCH_PROF_START(
-        event_tracer,
-        event_tracer_local_scope,
-        "+EthosUBackend::execute()processed_data");
-    const char* data =
-        static_cast<const char*>(execution_handle->processed->data());
-    EXECUTORCH_PROF_END(event_tracer, event_tracer_local_scope);
-
-    ET_LOG(Debug, "data:%p", data);
-
-    EXECUTORCH_PROF_START(
-        event_tracer,
-        event_tracer_local_scope,
-        "+EthosUBackend::execute()vela_bin_read()");
-    // Read key sections from the vela_bin_stream
-    if (vela_bin_read(data, &handles, execution_handle->processed->size()) ==
-        false) {
-      ET_LOG(Error, "vela_read: error, invalid binary layout");
-      return Error::InvalidProgram;
-    }
-    EXECUTORCH_PROF_END(event_tracer, event_tracer_local_scope);
-
-    MemoryAllocator* temp_allocator = context.get_temp_allocator();
-    // Use a temporary allocator for the intermediate tensors of the
-    // computation. The allocator is released in runtime/executor/method.cpp at
-    // the end of the execution of the Ethos-U custom delegate
-    // Ethos-U driver requires 16 bit alignment.
-    char* ethosu_scratch = static_cast<char*>(
-        temp_allocator->allocate(handles.scratch_data_size, 16UL));
-    if (ethosu_scratch == nullptr) {
+    char* ethosu_scratch = shared_scratch;
+    if ((ethosu_scratch != nullptr) &&
+        (shared_scratch_size < handles.scratch_data_size)) {
       ET_LOG(
           Error,
-          "Failed to allocate scratch buffer of %zu bytes from temp_allocator",
+          "Shared scratch of %zu bytes is smaller than the %zu bytes needed",
+          shared_scratch_size,
           handles.scratch_data_size);
       return Error::MemoryAllocationFailed;
     }
+    if (ethosu_scratch == nullptr) {
+      MemoryAllocator* temp_allocator = context.get_temp_allocator();
+      // Use a temporary allocator for the intermediate tensors of the
+      // computation. The allocator is released in runtime/executor/method.cpp
+      // at the end of the execution of the Ethos-U custom delegate
+      // Ethos-U driver requires 16 bit alignment.
+      ethosu_scratch = static_cast<char*>(
+          temp_allocator->allocate(handles.scratch_data_size, 16UL));
+      if (ethosu_scratch == nullptr) {
+        ET_LOG(
+            Error,
+            "Failed to allocate scratch buffer of %zu bytes from temp_allocator",
+            handles.scratch_data_size);
+        return Error::MemoryAllocationFailed;
+      }
+    }
+
+    // Select copy routines on the first run, or if a tensor size changed
+    if (!io_plan_valid(execution_handle, args)) {
+      EXECUTORCH_PROF_SCOPE(event_tracer, "+EthosUBackend::execute()plan_io()");
+      Error status = plan_io(execution_handle, args, ethosu_scratch);
+      if (status != Error::Ok) {
+        return status;
+      }
+    }
     ET_LOG(
         Debug,
         "Running program data:\n  cmd %p %zu\n  weight %p %zu\n  scratch %p %zu\n  fast scratch %p %zu\n",
@@ -219,65 +334,298 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
         ethosu_fast_scratch,
         ethosu_fast_scratch_size);
 
-    // Write argument values (from EValue tensor) into Ethos-U scratch
-    // TODO(MLETORCH-123): Optimise into direct write from Vela into the SRAM
-    //                     or DRAM output for compatible data layouts.
+    // Write argument values (from EValue tensor) into Ethos-U scratch.
+    // Inputs already in place have been written there by their producer.
     for (int i = 0; i < handles.inputs->count; i++) {
-      auto tensor_count = 1, io_count = 1;
       auto tensor_in = args[i]->toTensor();
       char* scratch_addr = ethosu_scratch + handles.inputs->io[i].offset;
 
+      if (!needs_copy(execution_handle, i, tensor_in, scratch_addr)) {
+        continue;
+      }
+
+      EXECUTORCH_PROF_SCOPE(
+          event_tracer, "+EthosUBackend::execute()handles.input.memcpy()");
+      // Sizes match and elt size matches so memcpy
+      memcpy(
+          scratch_addr, tensor_in.mutable_data_ptr<char>(), tensor_in.nbytes());
+    }
+
+    // Allocate driver handle and synchronously invoke driver
+    auto driver =
+        std::unique_ptr<ethosu_driver, decltype(&ethosu_release_driver)>(
+            ethosu_reserve_driver(), ethosu_release_driver);
+    if (driver == NULL) {
+      ET_LOG(Error, "ethosu_reserve_driver failed");
+      return Error::InvalidState;
+    }
+
+    // Weight and fast scratch bases are fixed at init(), the scratch
+    // written above in this function changes per execution.
+    execution_handle->bases[1] =
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ethosu_scratch));
+
+    int result = 0;
+    EXECUTORCH_PROF_START(
+        event_tracer, event_tracer_local_scope, "+EthosUBackend::execute()NPU");
+
+    if (async_job.requested) {
+      // Start the job and leave output copy-back to EthosUBackend_wait()
+      async_job.requested = false;
+      result = ethosu_invoke_async(
+          driver.get(),
+          static_cast<const void*>(handles.cmd_data),
+          handles.cmd_data_size,
+          execution_handle->bases,
+          execution_handle->bases_size,
+          ETHOSU_NUM_BASE_ADDRS,
+          nullptr);
+      if (result != 0) {
+        EXECUTORCH_PROF_END(event_tracer, event_tracer_local_scope);
+        ET_LOG(Error, "Ethos-U async invocation failed error (%d)", result);
+        return Error::InvalidProgram;
+      }
+      async_job.driver = driver.release();
+      async_job.handle = execution_handle;
+      async_job.args = args;
+      async_job.scratch = ethosu_scratch;
+#if defined(ET_EVENT_TRACER_ENABLED)
+      // The NPU and execute() events end when the job is collected, so the
+      // same events as for a synchronous execution are recorded.
+      async_job.event_tracer = event_tracer;
+      async_job.npu_entry = event_tracer_local_scope;
+      async_job.execute_entry = event_tracer_scope.release();
+#else
+      async_job.event_tracer = nullptr;
+#endif
+      CollectArm_CPU_Cycles.release();
+      return Error::Ok;
+    }
+
+    result = ethosu_invoke_v3(
+        driver.get(),
+        static_cast<const void*>(handles.cmd_data),
+        handles.cmd_data_size,
+        execution_handle->bases,
+        execution_handle->bases_size,
+        ETHOSU_NUM_BASE_ADDRS, /* fixed array of pointers to binary interface*/
+        nullptr);
+    EXECUTORCH_PROF_END(event_tracer, event_tracer_local_scope);
+
+    if (result != 0) {
+      ET_LOG(Error, "Ethos-U invocation failed error (%d)", result);
+      return Error::InvalidProgram;
+    }
+#if defined(ET_EVENT_TRACER_ENABLED)
+    return copy_outputs(execution_handle, args, ethosu_scratch, event_tracer);
+#else
+    return copy_outputs(execution_handle, args, ethosu_scratch, nullptr);
+#endif
+  }
+
+  // Completes the job started by an async execute(): waits for the NPU,
+  // copies the outputs back unless discarded and ends the events and the
+  // execute callbacks left open by execute().
+  Error wait_async(bool discard) const {
+    async_job.requested = false;
+    if (async_job.driver == nullptr) {
+      return Error::Ok;
+    }
+    int result = ethosu_wait(async_job.driver, true);
+    ethosu_release_driver(async_job.driver);
+    async_job.driver = nullptr;
+#if defined(ET_EVENT_TRACER_ENABLED)
+    if (async_job.event_tracer != nullptr) {
+      EXECUTORCH_PROF_END(async_job.event_tracer, async_job.npu_entry);
+    }
+#endif
+
+    Error status = Error::Ok;
+    if (result != 0) {
+      ET_LOG(Error, "Ethos-U invocation failed error (%d)", result);
+      status = Error::InvalidProgram;
+    } else if (!discard) {
+      status = copy_outputs(
+          async_job.handle,
+          async_job.args,
+          async_job.scratch,
+          async_job.event_tracer);
+    }
+
+#if defined(ET_EVENT_TRACER_ENABLED)
+    if (async_job.event_tracer != nullptr) {
+      EXECUTORCH_PROF_END(async_job.event_tracer, async_job.execute_entry);
+    }
+#endif
+    EthosUBackend_execute_end();
+    return status;
+  }
+
+  // Write outputs from scratch into EValue pointers
+  Error copy_outputs(
+      ExecutionHandle* execution_handle,
+      Span<EValue*> args,
+      const char* ethosu_scratch,
+      executorch::runtime::EventTracer* event_tracer) const {
+    const VelaHandles& handles = execution_handle->handles;
+    for (int i = 0; i < handles.outputs->count; i++) {
+      const char* output_addr = ethosu_scratch + handles.outputs->io[i].offset;
+      // Outputs are in the index immediately after inputs
+      const int arg_index = handles.inputs->count + i;
+      auto tensor_out = args[arg_index]->toTensor();
+      const IOPlan& plan = execution_handle->io_plan[arg_index];
+
+      if (!needs_copy(execution_handle, arg_index, tensor_out, output_addr)) {
+        continue;
+      }
+
+      if (plan.copy == kIOCopyLayout) {
+        Error status = copy_with_layout_adjustment(
+            handles.outputs->io[i],
+            i,
+            output_addr,
+            tensor_out,
+            plan.tensor_bytes);
+        if (status != Error::Ok) {
+          ET_LOG(
+              Error,
+              "Output %d: copy_with_layout_adjustment FAILED status=%d",
+              i,
+              static_cast<int>(status));
+          return status;
+        }
+      } else {
+        EXECUTORCH_PROF_SCOPE(
+            event_tracer, "+EthosUBackend::execute()handles.output.memcpy()");
+
+        memcpy(
+            tensor_out.mutable_data_ptr<char>(),
+            static_cast<const char*>(output_addr),
+            plan.tensor_bytes);
+      }
+    }
+    return Error::Ok;
+  }
+
+  void destroy(DelegateHandle* handle) const override {
+    return;
+  }
+
+ private:
+  // Returns true when every delegate argument still has the size its copy
+  // routine was selected for.
+  bool io_plan_valid(const ExecutionHandle* handle, Span<EValue*> args) const {
+    for (int i = 0; i < handle->io_count; i++) {
+      const IOPlan& plan = handle->io_plan[i];
+      if (plan.copy == kIOCopyUnplanned ||
+          plan.tensor_bytes != args[i]->toTensor().nbytes()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Returns false if the argument data is at its scratch location and no
+  // copy is needed. A tensor moved away by the caller (for example through
+  // Method::set_input() or set_output_data_ptr()) falls back to copying.
+  bool needs_copy(
+      ExecutionHandle* handle,
+      int arg_index,
+      const executorch::aten::Tensor& tensor,
+      const char* scratch_addr) const {
+    IOPlan& plan = handle->io_plan[arg_index];
+    if (plan.copy != kIOCopyInPlace) {
+      return true;
+    }
+    if (tensor.const_data_ptr() == scratch_addr) {
+      return false;
+    }
+    plan.copy = kIOCopyMemcpy;
+    report_io_binding(handle, arg_index, "data pointer rebound by caller");
+    return true;
+  }
+
+  // Reports the binding chosen for a delegate argument.
+  void report_io_binding(
+      const ExecutionHandle* handle,
+      int arg_index,
+      const char* reason) const {
+    const int n_inputs = handle->handles.inputs->count;
+    const int is_output = arg_index >= n_inputs ? 1 : 0;
+    const int index = is_output ? arg_index - n_inputs : arg_index;
+    if (reason == nullptr) {
+      ET_LOG(
+          Info,
+          "%s %d: zero-copy, in place in scratch",
+          is_output ? "Output" : "Input",
+          index);
+    } else {
+      ET_LOG(
+          Info,
+          "%s %d: copied, %s",
+          is_output ? "Output" : "Input",
+          index,
+          reason);
+    }
+    EthosUBackend_io_binding(is_output, index, reason);
+  }
+
+  // Returns why a delegate argument is copied, or nullptr if its data is
+  // already at its scratch location. Tensor data pointers are never moved
+  // by the backend: memory planned tensors belong to the Method.
+  const char* copy_reason(
+      const ExecutionHandle* handle,
+      Span<EValue*> args,
+      int arg_index,
+      const char* scratch_addr) const {
+    if (shared_scratch == nullptr) {
+      return "no shared scratch";
+    }
+    if (handle->io_plan[arg_index].copy == kIOCopyLayout) {
+      return "padded or packed layout";
+    }
+    if (args[arg_index]->toTensor().const_data_ptr() != scratch_addr) {
+      return "tensor data outside scratch";
+    }
+    return nullptr;
+  }
+
+  // Validates the delegate arguments against the Vela I/O descriptors and
+  // selects a copy routine for each of them. Arguments whose data is already
+  // at their scratch location are used in place.
+  Error plan_io(ExecutionHandle* handle, Span<EValue*> args, char* scratch)
+      const {
+    const VelaHandles& handles = handle->handles;
+
+    for (int i = 0; i < handles.inputs->count; i++) {
+      int tensor_count = 1, io_count = 1;
+      auto tensor_in = args[i]->toTensor();
+      const int elem_size = handles.inputs->io[i].elem_size;
+
       // We accept:
       bool supported = 0;
       // 32 bit int (simple non-quantised test cases)
       supported |=
-          (tensor_in.scalar_type() == ScalarType::Int and
-           handles.inputs->io[i].elem_size == 4);
+          (tensor_in.scalar_type() == ScalarType::Int and elem_size == 4);
       // 8 bit int (IOQDQ pass prepared networks)
       supported |=
-          (tensor_in.scalar_type() == ScalarType::Char and
-           handles.inputs->io[i].elem_size == 1);
+          (tensor_in.scalar_type() == ScalarType::Char and elem_size == 1);
       // 16 bit int (IOQDQ pass prepared networks)
       supported |=
-          (tensor_in.scalar_type() == ScalarType::Short and
-           handles.inputs->io[i].elem_size == 2);
+          (tensor_in.scalar_type() == ScalarType::Short and elem_size == 2);
       // bool (IOQDQ pass prepared networks)
       supported |=
-          (tensor_in.scalar_type() == ScalarType::Bool and
-           handles.inputs->io[i].elem_size == 1);
+          (tensor_in.scalar_type() == ScalarType::Bool and elem_size == 1);
       if (!supported) {
         ET_LOG(
             Error,
             "Input %d expected Integer (4 byte), Char (1 byte) or Bool (1 byte) integer inputs, got ScalarType id %s size %d",
             i,
             executorch::runtime::toString(tensor_in.scalar_type()),
-            handles.inputs->io[i].elem_size);
+            elem_size);
         return Error::InvalidProgram;
       }
 
-      // Select a compatible copy routine including checking for input layouts
-      // which require permutation.
-      bool both_int = tensor_in.scalar_type() == ScalarType::Int &&
-          handles.inputs->io[i].elem_size == 4;
-      bool both_char = tensor_in.scalar_type() == ScalarType::Char &&
-          handles.inputs->io[i].elem_size == 1;
-      bool both_short = tensor_in.scalar_type() == ScalarType::Short &&
-          handles.inputs->io[i].elem_size == 2;
-      bool both_bool = tensor_in.scalar_type() == ScalarType::Bool &&
-          (handles.inputs->io[i].elem_size == 1);
-
-      if (both_char || both_int || both_short || both_bool) {
-        EXECUTORCH_PROF_SCOPE(
-            event_tracer, "+EthosUBackend::execute()handles.input.memcpy()");
-        // Sizes match and elt size matches so memcpy
-        memcpy(
-            scratch_addr,
-            tensor_in.mutable_data_ptr<char>(),
-            tensor_in.nbytes());
-      } else {
-        ET_LOG(Error, "No matching input copy routine");
-        return Error::InvalidProgram;
-      }
       calculate_dimensions(
           tensor_in, &handles.inputs->io[i], &tensor_count, &io_count);
       if (tensor_count != io_count) {
@@ -289,57 +637,18 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
             tensor_count);
         return Error::InvalidProgram;
       }
-    }
 
-    // Allocate driver handle and synchronously invoke driver
-    auto driver =
-        std::unique_ptr<ethosu_driver, decltype(&ethosu_release_driver)>(
-            ethosu_reserve_driver(), ethosu_release_driver);
-    if (driver == NULL) {
-      ET_LOG(Error, "ethosu_reserve_driver failed");
-      return Error::InvalidState;
+      // Sizes match and elt size matches so memcpy
+      handle->io_plan[i].tensor_bytes = tensor_in.nbytes();
+      handle->io_plan[i].copy = kIOCopyMemcpy;
     }
 
-    // Ethos-U low level driver expected order for Ethos U-55, we have
-    // constant weight data, then scratch (which contains input and output)
-    // scratch is written above in this function.
-
-    uint64_t bases[ETHOSU_NUM_BASE_ADDRS] = {
-        static_cast<uint64_t>(
-            reinterpret_cast<uintptr_t>((handles.weight_data))),
-        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ethosu_scratch)),
-        static_cast<uint64_t>(
-            reinterpret_cast<uintptr_t>(ethosu_fast_scratch))};
-    size_t bases_size[ETHOSU_NUM_BASE_ADDRS] = {
-        handles.weight_data_size,
-        handles.scratch_data_size,
-        ethosu_fast_scratch_size};
-    int result = 0;
-    EXECUTORCH_PROF_START(
-        event_tracer, event_tracer_local_scope, "+EthosUBackend::execute()NPU");
-    result = ethosu_invoke_v3(
-        driver.get(),
-        static_cast<const void*>(handles.cmd_data),
-        handles.cmd_data_size,
-        bases,
-        bases_size,
-        ETHOSU_NUM_BASE_ADDRS, /* fixed array of pointers to binary interface*/
-        nullptr);
-    EXECUTORCH_PROF_END(event_tracer, event_tracer_local_scope);
-
-    if (result != 0) {
-      ET_LOG(Error, "Ethos-U invocation failed error (%d)", result);
-      return Error::InvalidProgram;
-    }
     size_t tensor_bytes_total = 0;
     size_t io_bytes_total = 0;
-    // Write outputs from scratch into EValue pointers
     for (int i = 0; i < handles.outputs->count; i++) {
       int tensor_count = 1, io_count = 1;
-      const char* output_addr = ethosu_scratch + handles.outputs->io[i].offset;
-      // Process input EValue into scratch
-      // Outputs are in the index immediately after inputs
-      auto tensor_out = args[handles.inputs->count + i]->toTensor();
+      const int arg_index = handles.inputs->count + i;
+      auto tensor_out = args[arg_index]->toTensor();
 
       calculate_dimensions(
           tensor_out, &handles.outputs->io[i], &tensor_count, &io_count);
@@ -349,7 +658,7 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
           static_cast<size_t>(handles.outputs->io[i].elem_size);
 
       ET_LOG(
-          Error,
+          Info,
           "Output %d: tensor_bytes=%zu io_bytes=%zu tensor_count=%d io_count=%d elem_size=%d shape=[%d,%d,%d,%d,%d,%d] tensor_dim=%d offset=%d",
           i,
           tensor_bytes,
@@ -366,32 +675,18 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
           tensor_out.dim(),
           handles.outputs->io[i].offset);
 
+      handle->io_plan[arg_index].tensor_bytes = tensor_bytes;
       if (tensor_bytes != io_bytes) {
         ET_LOG(
-            Error,
-            "Output %d: MISMATCH tensor_bytes(%zu) != io_bytes(%zu)",
+            Info,
+            "Output %d: tensor_bytes(%zu) != io_bytes(%zu), copy with layout adjustment",
             i,
             tensor_bytes,
             io_bytes);
-        Error status = copy_with_layout_adjustment(
-            handles.outputs->io[i], i, output_addr, tensor_out, tensor_bytes);
-        if (status != Error::Ok) {
-          ET_LOG(
-              Error,
-              "Output %d: copy_with_layout_adjustment FAILED status=%d",
-              i,
-              static_cast<int>(status));
-          return status;
-        }
+        handle->io_plan[arg_index].copy = kIOCopyLayout;
         io_bytes_total += tensor_bytes;
       } else {
-        EXECUTORCH_PROF_SCOPE(
-            event_tracer, "+EthosUBackend::execute()handles.output.memcpy()");
-
-        memcpy(
-            tensor_out.mutable_data_ptr<char>(),
-            static_cast<const char*>(output_addr),
-            tensor_bytes);
+        handle->io_plan[arg_index].copy = kIOCopyMemcpy;
         io_bytes_total += io_bytes;
       }
 
@@ -406,16 +701,25 @@ class EthosUBackend final : public ::executorch::runtime::BackendInterface {
           "Program expects %zu bytes but got %zu",
           io_bytes_total,
           tensor_bytes_total);
+      // Leave the plan unset so the next execute() validates again
+      handle->io_plan[handles.inputs->count].copy = kIOCopyUnplanned;
       return Error::InvalidProgram;
     }
-    return Error::Ok;
-  }
 
-  void destroy(DelegateHandle* handle) const override {
-    return;
+    for (int i = 0; i < handle->io_count; i++) {
+      const bool is_output = i >= handles.inputs->count;
+      const VelaIO& io = is_output
+          ? handles.outputs->io[i - handles.inputs->count]
+          : handles.inputs->io[i];
+      const char* reason = copy_reason(handle, args, i, scratch + io.offset);
+      if (reason == nullptr) {
+        handle->io_plan[i].copy = kIOCopyInPlace;
+      }
+      report_io_binding(handle, i, reason);
+    }
+    return Error::Ok;
   }
 
- private:
   // Copies Vela output into the ExecuTorch tensor, adjusting for padding or
   // packed layouts produced by the delegate.
   Error copy_with_layout_adjustment(
@@ -588,6 +892,63 @@ auto EthosUBackend_backend = EthosUBackend();
 Backend EthosUBackend_id{"EthosUBackend", &EthosUBackend_backend};
 static executorch::runtime::Error EthosUBackend_registered =
     register_backend(EthosUBackend_id);
+} // namespace
+
+extern "C" {
+// Make the next EthosUBackend execute() return as soon as the NPU job is
+// started. The outputs of that delegate call are not valid until
+// EthosUBackend_wait() returns, so the caller has to drive the Method with
+// step() and stop stepping while a job is pending.
+// Returns 0 on success, or -1 if a request or a job is already outstanding.
+int EthosUBackend_request_async(void) {
+  if (async_job.requested || (async_job.driver != nullptr)) {
+    ET_LOG(Error, "Ethos-U async request rejected, one is already pending");
+    return -1;
+  }
+  async_job.requested = true;
+  return 0;
+}
+
+// Returns non-zero while an async job started by execute() is outstanding.
+int EthosUBackend_async_pending(void) {
+  return async_job.driver != nullptr ? 1 : 0;
+}
+
+// Blocks until the outstanding async job is done and copies its outputs.
+// Returns 0 on success, or if no job was pending.
+int EthosUBackend_wait(void) {
+  return static_cast<int>(EthosUBackend_backend.wait_async(false));
+}
+
+// Withdraws an async request not yet taken by execute(), or waits for the
+// outstanding job without copying its outputs. Used when the Method failed
+// before or after the job was started.
+void EthosUBackend_cancel_async(void) {
+  (void)EthosUBackend_backend.wait_async(true);
+}
+
+// Returns the largest scratch size of the delegates initialized so far, the
+// size of the scratch shared by all of them.
+size_t EthosUBackend_scratch_size(void) {
+  return scratch_size_max;
+}
+
+// Sets the scratch shared by all delegates, 16 byte aligned and at least
+// EthosUBackend_scratch_size() bytes. nullptr takes the scratch from the
+// temp allocator on every execute(). Must not be changed while a job is
+// pending. Returns 0 on success, or -1 if a job is pending.
+int EthosUBackend_set_scratch(void* scratch, size_t size) {
+  if (async_job.driver != nullptr) {
+    ET_LOG(Error, "Ethos-U scratch can not change while a job is pending");
+    return -1;
+  }
+  shared_scratch = static_cast<char*>(scratch);
+  shared_scratch_size = (scratch != nullptr) ? size : 0;
+  return 0;
+}
+}
+
+namespace {
 
 #ifdef __ZEPHYR__
 /**